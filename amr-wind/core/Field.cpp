@@ -108,6 +108,12 @@ Field::Field(
 
 Field::~Field() = default;
 
+unsigned Field::next_version() noexcept
+{
+    static unsigned counter{0};
+    return ++counter;
+}
+
 Field& Field::state(const FieldState fstate)
 {
     const auto& fstates = m_info->m_states;
@@ -198,6 +204,7 @@ void Field::fillpatch(amrex::Real time, amrex::IntVect ng) noexcept
         fop.fillpatch(
             lev, time, m_repo.get_multifab(m_id, lev), ng, field_state());
     }
+    mark_modified();
 }
 
 void Field::fillpatch(amrex::Real time) noexcept
@@ -229,6 +236,7 @@ void Field::fillphysbc(amrex::Real time, amrex::IntVect ng) noexcept
         fop.fillphysbc(
             lev, time, m_repo.get_multifab(m_id, lev), ng, field_state());
     }
+    mark_modified();
 }
 
 void Field::fillphysbc(amrex::Real time) noexcept
@@ -264,15 +272,25 @@ void Field::advance_states() noexcept
         return;
     }
 
+    // Rotate states: NM1 <- N <- NP1 <- (oldest)
     for (int i = num_time_states() - 1; i > 0; --i) {
         const auto sold = static_cast<FieldState>(i);
         const auto snew = static_cast<FieldState>(i - 1);
-        auto& old_field = state(sold);
-        auto& new_field = state(snew);
+        m_repo.swap_field_data(state(sold), state(snew));
+        std::swap(state(sold).m_version, state(snew).m_version);
+    }
+
+    // Restoring New from Old leaves its contents (and version) unchanged
+    auto& new_field = state(FieldState::New);
+    if (new_field.copy_on_advance()) {
+        const auto& old_field = state(FieldState::Old);
         for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
             amrex::MultiFab::Copy(
-                old_field(lev), new_field(lev), 0, 0, num_comp(), num_grow());
+                new_field(lev), old_field(lev), 0, 0, num_comp(), num_grow());
         }
+        new_field.copy_version(old_field);
+    } else {
+        new_field.mark_modified();
     }
 }
 
@@ -286,6 +304,7 @@ void Field::copy_state(FieldState to_state, FieldState from_state) noexcept
         amrex::MultiFab::Copy(
             to_field(lev), from_field(lev), 0, 0, num_comp(), num_grow());
     }
+    to_field.copy_version(from_field);
 }
 
 Field& Field::create_state(const FieldState fstate) noexcept
@@ -304,6 +323,7 @@ void Field::setVal(amrex::Real value) noexcept
     for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
         operator()(lev).setVal(value);
     }
+    mark_modified();
 }
 
 void Field::setVal(
@@ -313,6 +333,7 @@ void Field::setVal(
     for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
         operator()(lev).setVal(value, start_comp, num_comp, nghost);
     }
+    mark_modified();
 }
 
 void Field::setVal(
@@ -330,6 +351,7 @@ void Field::setVal(
             mf.setVal(value, ic, ncomp, nghost);
         }
     }
+    mark_modified();
 }
 
 void Field::set_default_fillpatch_bc(
@@ -379,6 +401,7 @@ void Field::to_uniform_space() noexcept
                 });
         }
     }
+    mark_modified();
     m_mesh_mapped = true;
 }
 
@@ -413,6 +436,7 @@ void Field::to_stretched_space() noexcept
                 });
         }
     }
+    mark_modified();
     m_mesh_mapped = false;
 }
 
@@ -1,6 +1,10 @@
+#include <iomanip>
+#include <iterator>
 #include <memory>
+#include <utility>
 
 #include "amr-wind/core/FieldRepo.H"
+#include "AMReX_MultiFabUtil.H"
 
 namespace amr_wind {
 
@@ -16,6 +20,8 @@ void FieldRepo::make_new_level_from_scratch(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_new_level_from_scratch");
+    invalidate_level_masks();
+    flush_scratch_pool();
     m_leveldata[lev] = std::make_unique<LevelDataHolder>();
 
     allocate_field_data(
@@ -33,12 +39,15 @@ void FieldRepo::make_new_level_from_coarse(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_level_from_coarse");
+    invalidate_level_masks();
+    flush_scratch_pool();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
     allocate_field_data(ba, dm, *ldata, *(ldata->m_int_fact));
 
     for (auto& field : m_field_vec) {
+        field->mark_modified();
         if (!field->fillpatch_on_regrid()) {
             continue;
         }
@@ -57,12 +66,15 @@ void FieldRepo::remake_level(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::remake_level");
+    invalidate_level_masks();
+    flush_scratch_pool();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
     allocate_field_data(ba, dm, *ldata, *(ldata->m_int_fact));
 
     for (auto& field : m_field_vec) {
+        field->mark_modified();
         if (!field->fillpatch_on_regrid()) {
             continue;
         }
@@ -77,9 +89,134 @@ void FieldRepo::remake_level(
 void FieldRepo::clear_level(int lev)
 {
     BL_PROFILE("amr-wind::FieldRepo::clear_level");
+    invalidate_level_masks();
+    flush_scratch_pool();
     m_leveldata[lev].reset();
 }
 
+void FieldRepo::invalidate_level_masks() noexcept
+{
+    for (auto& mask : m_level_masks) {
+        mask.reset();
+    }
+}
+
+void FieldRepo::flush_scratch_pool() noexcept
+{
+    m_scratch_pool.clear();
+    m_scratch_stats.num_pooled = 0;
+    m_scratch_stats.pooled_bytes = 0;
+    ++m_grid_generation;
+}
+
+void FieldRepo::discard_scratch_data(const int num) const noexcept
+{
+    for (int i = 0; i < num; ++i) {
+        m_scratch_stats.pooled_bytes -= m_scratch_pool[i].nbytes;
+    }
+    m_scratch_pool.erase(m_scratch_pool.begin(), m_scratch_pool.begin() + num);
+    m_scratch_stats.num_pooled -= num;
+    m_scratch_stats.num_discarded += num;
+}
+
+void FieldRepo::trim_scratch_pool() noexcept
+{
+    // Entries are stored in the order they were released
+    int num = 0;
+    while ((num < m_scratch_pool.size()) &&
+           (m_scratch_pool[num].step < m_scratch_step)) {
+        ++num;
+    }
+    discard_scratch_data(num);
+    ++m_scratch_step;
+}
+
+void FieldRepo::release_scratch_data(ScratchField& field) const noexcept
+{
+    if (!m_use_scratch_pool || (field.m_grid_generation != m_grid_generation) ||
+        (field.m_data.size() != num_active_levels())) {
+        return;
+    }
+
+    // Only recycle data that still matches the current mesh layout
+    for (int lev = 0; lev < num_active_levels(); ++lev) {
+        const auto& mf = field.m_data[lev];
+        if ((mf.nComp() != field.m_ncomp) ||
+            (mf.nGrowVect() != field.m_ngrow) ||
+            !mf.boxArray().CellEqual(m_mesh.boxArray(lev)) ||
+            (mf.DistributionMap() != m_mesh.DistributionMap(lev))) {
+            return;
+        }
+    }
+
+    amrex::Long nbytes = 0;
+    for (const auto& mf : field.m_data) {
+        for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            nbytes += mf[mfi].nBytes();
+        }
+    }
+
+    if (m_scratch_pool_max_bytes >= 0) {
+        if (nbytes > m_scratch_pool_max_bytes) {
+            ++m_scratch_stats.num_discarded;
+            return;
+        }
+
+        // Make room by freeing the least recently released data
+        int num = 0;
+        amrex::Long pooled_bytes = m_scratch_stats.pooled_bytes;
+        while (pooled_bytes + nbytes > m_scratch_pool_max_bytes) {
+            pooled_bytes -= m_scratch_pool[num++].nbytes;
+        }
+        discard_scratch_data(num);
+    }
+
+    m_scratch_pool.push_back(
+        {field.m_ncomp, field.m_ngrow, field.m_floc, std::move(field.m_data),
+         nbytes, m_scratch_step});
+    ++m_scratch_stats.num_pooled;
+    m_scratch_stats.pooled_bytes += nbytes;
+}
+
+void FieldRepo::print_scratch_stats() const
+{
+    // Pooled data is held per rank, report the largest pool
+    amrex::Long pooled_bytes = m_scratch_stats.pooled_bytes;
+    amrex::ParallelDescriptor::ReduceLongMax(pooled_bytes);
+
+    amrex::Print() << "Scratch fields: requests = "
+                   << m_scratch_stats.num_requests
+                   << ", reused = " << m_scratch_stats.num_reused
+                   << ", allocated = "
+                   << (m_scratch_stats.num_requests -
+                       m_scratch_stats.num_reused)
+                   << ", pooled = " << m_scratch_stats.num_pooled << " ("
+                   << std::setprecision(3)
+                   << static_cast<double>(pooled_bytes) / (1024.0 * 1024.0)
+                   << " MB)"
+                   << ", discarded = " << m_scratch_stats.num_discarded
+                   << std::endl;
+}
+
+const amrex::iMultiFab& FieldRepo::level_mask(const int lev) const
+{
+    BL_ASSERT(lev <= m_mesh.finestLevel());
+    auto& mask = m_level_masks[lev];
+    if (!mask) {
+        BL_PROFILE("amr-wind::FieldRepo::level_mask");
+        if (lev < m_mesh.finestLevel()) {
+            mask = std::make_unique<amrex::iMultiFab>(amrex::makeFineMask(
+                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev),
+                m_mesh.boxArray(lev + 1), m_mesh.refRatio(lev), 1, 0));
+        } else {
+            mask = std::make_unique<amrex::iMultiFab>(
+                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev), 1, 0);
+            mask->setVal(1);
+        }
+    }
+    return *mask;
+}
+
 Field& FieldRepo::declare_field(
     const std::string& name,
     const int ncomp,
@@ -308,6 +445,21 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
 
     std::unique_ptr<ScratchField> field(
         new ScratchField(*this, name, ncomp, nghost, floc));
+    field->m_grid_generation = m_grid_generation;
+    ++m_scratch_stats.num_requests;
+
+    // Most recently released data first, it is more likely to be in cache
+    for (auto it = m_scratch_pool.rbegin(); it != m_scratch_pool.rend(); ++it) {
+        if ((it->ncomp == ncomp) && (it->ngrow == field->m_ngrow) &&
+            (it->floc == floc)) {
+            field->m_data = std::move(it->data);
+            m_scratch_stats.pooled_bytes -= it->nbytes;
+            m_scratch_pool.erase(std::next(it).base());
+            ++m_scratch_stats.num_reused;
+            --m_scratch_stats.num_pooled;
+            return field;
+        }
+    }
 
     for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
         const auto ba =
@@ -336,6 +488,21 @@ void FieldRepo::advance_states() noexcept
     }
 }
 
+void FieldRepo::swap_field_data(
+    const Field& field1, const Field& field2) noexcept
+{
+    AMREX_ASSERT(field1.num_comp() == field2.num_comp());
+    AMREX_ASSERT(field1.num_grow() == field2.num_grow());
+    AMREX_ASSERT(field1.field_location() == field2.field_location());
+
+    // Swapping the MultiFab objects in place keeps all references and
+    // pointers to the level data of a field valid
+    for (int lev = 0; lev < num_active_levels(); ++lev) {
+        std::swap(
+            get_multifab(field1.id(), lev), get_multifab(field2.id(), lev));
+    }
+}
+
 void FieldRepo::allocate_field_data(
     const amrex::BoxArray& ba,
     const amrex::DistributionMapping& dm,
@@ -54,6 +54,19 @@ void MLMGOptions::parse_options(const std::string& prefix)
     pp.query("hypre_interface", hypre_interface);
     pp.query("do_nsolve", do_nsolve);
     pp.query("nsolve_grid_size", nsolve_grid_size);
+
+    pp.query("warm_start", warm_start);
+    pp.query("adaptive_tol_factor", adaptive_tol_factor);
+    pp.query("adaptive_max_rel_tol", adaptive_max_rel_tol);
+}
+
+amrex::Real MLMGOptions::solve_rel_tol(const amrex::Real cfl) const
+{
+    if (adaptive_tol_factor <= 0.0) {
+        return rel_tol;
+    }
+    return amrex::max(
+        rel_tol, amrex::min(adaptive_max_rel_tol, adaptive_tol_factor * cfl));
 }
 
 void MLMGOptions::operator()(amrex::MLMG& mlmg)
@@ -73,6 +86,12 @@ void MLMGOptions::operator()(amrex::MLMG& mlmg)
     mlmg.setFinalSmooth(num_final_smooth);
     mlmg.setBottomSmooth(num_bottom_smooth);
 
+    // A warm-started solve begins with a small residual, so convergence is
+    // measured relative to the right-hand side instead
+    if (warm_start || (adaptive_tol_factor > 0.0)) {
+        mlmg.setAlwaysUseBNorm(1);
+    }
+
     mlmg.setBottomVerbose(bottom_verbose);
     mlmg.setBottomTolerance(bottom_rel_tol);
     mlmg.setBottomToleranceAbs(bottom_abs_tol);
@@ -39,4 +39,18 @@ void MeshMap::declare_mapping_fields(const CFDSim& sim, int nghost)
     // TODO: Create BCNoOP fill patch operators for mesh scaling fields ?
 }
 
+void MeshMap::mark_modified()
+{
+    for (auto* fld :
+         {m_mesh_scale_fac_cc, m_mesh_scale_fac_nd, m_mesh_scale_fac_xf,
+          m_mesh_scale_fac_yf, m_mesh_scale_fac_zf, m_mesh_scale_detJ_cc,
+          m_mesh_scale_detJ_nd, m_mesh_scale_detJ_xf, m_mesh_scale_detJ_yf,
+          m_mesh_scale_detJ_zf, m_non_uniform_coord_cc,
+          m_non_uniform_coord_nd}) {
+        if (fld != nullptr) {
+            fld->mark_modified();
+        }
+    }
+}
+
 } // namespace amr_wind
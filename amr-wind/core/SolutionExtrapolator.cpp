@@ -0,0 +1,107 @@
+#include "amr-wind/core/SolutionExtrapolator.H"
+
+#include <utility>
+
+namespace amr_wind {
+
+namespace {
+
+bool same_layout(const amrex::MultiFab& a, const amrex::MultiFab& b)
+{
+    return a.ok() && (a.boxArray() == b.boxArray()) &&
+           (a.DistributionMap() == b.DistributionMap()) &&
+           (a.nComp() == b.nComp());
+}
+
+} // namespace
+
+void SolutionExtrapolator::store(
+    const amrex::Vector<const amrex::MultiFab*>& sol, const amrex::Real time)
+{
+    BL_PROFILE("amr-wind::SolutionExtrapolator::store");
+    const int nlevels = sol.size();
+
+    // Discard the history if the grids have changed
+    bool compatible = (static_cast<int>(m_sol[1].size()) == nlevels);
+    for (int lev = 0; compatible && (lev < nlevels); ++lev) {
+        compatible = same_layout(m_sol[1][lev], *sol[lev]);
+    }
+    if (!compatible) {
+        m_nstored = 0;
+        m_sol[0].clear();
+        m_sol[1].clear();
+        m_sol[1].resize(nlevels);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            m_sol[1][lev].define(
+                sol[lev]->boxArray(), sol[lev]->DistributionMap(),
+                sol[lev]->nComp(), 0);
+        }
+    }
+
+    // The latest solution becomes the previous one unless it was obtained at
+    // the same time
+    if ((m_nstored > 0) && (time != m_time[1])) {
+        std::swap(m_sol[0], m_sol[1]);
+        m_time[0] = m_time[1];
+        if (m_sol[1].empty()) {
+            m_sol[1].resize(nlevels);
+            for (int lev = 0; lev < nlevels; ++lev) {
+                m_sol[1][lev].define(
+                    sol[lev]->boxArray(), sol[lev]->DistributionMap(),
+                    sol[lev]->nComp(), 0);
+            }
+        }
+        m_nstored = 2;
+    } else if (m_nstored == 0) {
+        m_nstored = 1;
+    }
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab::Copy(
+            m_sol[1][lev], *sol[lev], 0, 0, sol[lev]->nComp(), 0);
+    }
+    m_time[1] = time;
+}
+
+bool SolutionExtrapolator::is_compatible(
+    const amrex::Vector<amrex::MultiFab*>& mfs) const
+{
+    if ((m_nstored == 0) || (m_sol[1].size() != mfs.size())) {
+        return false;
+    }
+    for (int lev = 0; lev < static_cast<int>(mfs.size()); ++lev) {
+        if (!same_layout(m_sol[1][lev], *mfs[lev])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SolutionExtrapolator::extrapolate(
+    const amrex::Vector<amrex::MultiFab*>& guess, const amrex::Real time) const
+{
+    BL_PROFILE("amr-wind::SolutionExtrapolator::extrapolate");
+    if (!is_compatible(guess)) {
+        return false;
+    }
+
+    const int nlevels = guess.size();
+    if (m_nstored < 2) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            amrex::MultiFab::Copy(
+                *guess[lev], m_sol[1][lev], 0, 0, guess[lev]->nComp(), 0);
+        }
+        return true;
+    }
+
+    // guess = sol_1 + w (sol_1 - sol_0)
+    const amrex::Real wt = (time - m_time[1]) / (m_time[1] - m_time[0]);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab::LinComb(
+            *guess[lev], 1.0 + wt, m_sol[1][lev], 0, -wt, m_sol[0][lev], 0, 0,
+            guess[lev]->nComp(), 0);
+    }
+    return true;
+}
+
+} // namespace amr_wind
@@ -66,8 +66,77 @@ void DiffSolverIface<LinOp>::setup_operator(
     for (int lev = 0; lev < nlevels; ++lev) {
         linop.setLevelBC(lev, &m_pdefields.field(lev));
     }
-    this->set_acoeffs(linop, fstate);
-    set_bcoeffs(linop);
+
+    // Coefficients are only pushed into the operator when the fields they
+    // are computed from have changed since the last call
+    auto& cvers = (&linop == m_solver.get()) ? m_solver_coeffs
+                                             : m_applier_coeffs;
+    if (alpha == 0.0) {
+        // The `a` coefficients are zeroed by the operator and not used
+        cvers.avers.clear();
+    } else {
+        // Versions identify the data regardless of the state it is held in
+        auto avers = acoeffs_version(fstate);
+        if (avers.empty() || (avers != cvers.avers)) {
+            this->set_acoeffs(linop, fstate);
+        }
+        cvers.avers = std::move(avers);
+    }
+
+    auto bvers = bcoeffs_version();
+    if (bvers != cvers.bvers) {
+        set_bcoeffs(linop);
+        cvers.bvers = std::move(bvers);
+    }
+}
+
+template <typename LinOp>
+amrex::Vector<unsigned>
+DiffSolverIface<LinOp>::acoeffs_version(const FieldState fstate)
+{
+    amrex::Vector<unsigned> vers{m_density.state(fstate).version()};
+    if (m_mesh_mapping) {
+        vers.push_back(
+            m_pdefields.repo.get_mesh_mapping_detJ(FieldLoc::CELL).version());
+    }
+    return vers;
+}
+
+template <typename LinOp>
+amrex::Vector<unsigned> DiffSolverIface<LinOp>::bcoeffs_version()
+{
+    amrex::Vector<unsigned> vers{m_pdefields.mueff.version()};
+    if (m_mesh_mapping) {
+        auto& repo = m_pdefields.repo;
+        vers.push_back(repo.get_mesh_mapping_field(FieldLoc::CELL).version());
+        vers.push_back(repo.get_mesh_mapping_detJ(FieldLoc::CELL).version());
+    }
+    return vers;
+}
+
+template <typename LinOp>
+void DiffSolverIface<LinOp>::update_bcoeffs()
+{
+    auto bvers = bcoeffs_version();
+    if (!m_bcoeffs.empty() && (bvers == m_bcoeffs_vers)) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::update_bcoeffs");
+    auto& repo = m_pdefields.repo;
+    const int nlevels = repo.num_active_levels();
+    const auto& viscosity = m_pdefields.mueff;
+    const auto& geom = repo.mesh().Geom();
+
+    m_bcoeffs.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        m_bcoeffs[lev] =
+            diffusion::average_velocity_eta_to_faces(geom[lev], viscosity(lev));
+        if (m_mesh_mapping) {
+            diffusion::viscosity_to_uniform_space(m_bcoeffs[lev], repo, lev);
+        }
+    }
+    m_bcoeffs_vers = std::move(bvers);
 }
 
 template <typename LinOp>
@@ -109,6 +178,7 @@ void DiffSolverIface<LinOp>::setup_solver(amrex::MLMG& mlmg)
 template <typename LinOp>
 void DiffSolverIface<LinOp>::linsys_solve_impl()
 {
+    const amrex::Real setup_start = amrex::ParallelDescriptor::second();
     FieldState fstate = FieldState::New;
     auto& repo = this->m_pdefields.repo;
     auto& field = this->m_pdefields.field;
@@ -147,11 +217,14 @@ void DiffSolverIface<LinOp>::linsys_solve_impl()
     amrex::MLMG mlmg(*this->m_solver);
     this->setup_solver(mlmg);
 
+    const amrex::Real solve_start = amrex::ParallelDescriptor::second();
     mlmg.solve(
         field.vec_ptrs(), rhs_ptr->vec_const_ptrs(), this->m_options.rel_tol,
         this->m_options.abs_tol);
 
-    io::print_mlmg_info(field.name() + "_solve", mlmg);
+    io::print_mlmg_info(
+        field.name() + "_solve", mlmg, solve_start - setup_start,
+        amrex::ParallelDescriptor::second() - solve_start);
 }
 
 template <typename LinOp>
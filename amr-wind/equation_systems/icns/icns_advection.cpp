@@ -39,6 +39,25 @@ amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM> get_projection_bc(
     return r;
 }
 
+//! Maximum CFL number based on the MAC velocities
+amrex::Real mac_cfl(const FieldRepo& repo, const amrex::Real dt)
+{
+    const auto& u_mac = repo.get_field("u_mac");
+    const auto& v_mac = repo.get_field("v_mac");
+    const auto& w_mac = repo.get_field("w_mac");
+
+    amrex::Real cfl = 0.0;
+    for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+        const auto& dx = repo.mesh().Geom(lev).CellSizeArray();
+        cfl = amrex::max(
+            cfl, u_mac(lev).norm0(0, 0, true) * dt / dx[0],
+            v_mac(lev).norm0(0, 0, true) * dt / dx[1],
+            w_mac(lev).norm0(0, 0, true) * dt / dx[2]);
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(cfl);
+    return cfl;
+}
+
 } // namespace
 
 MacProjOp::MacProjOp(
@@ -125,6 +144,7 @@ void MacProjOp::init_projector(const amrex::Real beta) noexcept
 void MacProjOp::operator()(const FieldState fstate, const amrex::Real dt)
 {
     BL_PROFILE("amr-wind::ICNS::advection_mac_project");
+    const amrex::Real setup_start = amrex::ParallelDescriptor::second();
     const auto& geom = m_repo.mesh().Geom();
     const auto& pressure = m_repo.get_field("p");
     auto& u_mac = m_repo.get_field("u_mac");
@@ -196,21 +216,57 @@ void MacProjOp::operator()(const FieldState fstate, const amrex::Real dt)
 
     m_mac_proj->setUMAC(mac_vec);
 
-    if (m_has_overset) {
+    const amrex::Real rel_tol =
+        (m_options.adaptive_tol_factor > 0.0)
+            ? m_options.solve_rel_tol(mac_cfl(m_repo, dt))
+            : m_options.rel_tol;
+
+    amrex::Real solve_start = 0.0;
+    if (m_has_overset || m_options.warm_start) {
         auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::CELL);
         for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
-            amrex::average_node_to_cellcenter(
-                (*phif)(lev), 0, pressure(lev), 0, 1);
+            (*phif)(lev).setVal(0.0);
         }
 
-        m_mac_proj->project(
-            phif->vec_ptrs(), m_options.rel_tol, m_options.abs_tol);
+        // phi relates to the pressure by dt / factor, the history is stored
+        // in units of pressure so that it remains valid when dt changes
+        const amrex::Real phi_scale = dt / factor;
+        bool has_guess = false;
+        if (m_options.warm_start) {
+            auto& hist = m_phi_history[fstate];
+            hist.clock += dt;
+            has_guess = hist.extrap.extrapolate(phif->vec_ptrs(), hist.clock);
+            if (has_guess) {
+                for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+                    (*phif)(lev).mult(phi_scale, 0, 1, 0);
+                }
+            }
+        }
+        if (!has_guess && m_has_overset) {
+            for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+                amrex::average_node_to_cellcenter(
+                    (*phif)(lev), 0, pressure(lev), 0, 1);
+            }
+        }
 
+        solve_start = amrex::ParallelDescriptor::second();
+        m_mac_proj->project(phif->vec_ptrs(), rel_tol, m_options.abs_tol);
+
+        if (m_options.warm_start) {
+            auto& hist = m_phi_history[fstate];
+            for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+                (*phif)(lev).mult(1.0 / phi_scale, 0, 1, 0);
+            }
+            hist.extrap.store(phif->vec_const_ptrs(), hist.clock);
+        }
     } else {
-        m_mac_proj->project(m_options.rel_tol, m_options.abs_tol);
+        solve_start = amrex::ParallelDescriptor::second();
+        m_mac_proj->project(rel_tol, m_options.abs_tol);
     }
 
-    io::print_mlmg_info("MAC_projection", m_mac_proj->getMLMG());
+    io::print_mlmg_info(
+        "MAC_projection", m_mac_proj->getMLMG(), solve_start - setup_start,
+        amrex::ParallelDescriptor::second() - solve_start);
 }
 
 void MacProjOp::mac_proj_to_uniform_space(
@@ -2,6 +2,11 @@
 #include "amr-wind/equation_systems/vof/SplitAdvection.H"
 #include "amr-wind/equation_systems/vof/split_advection.H"
 #include <AMReX_Geometry.H>
+#include <AMReX_GpuAtomic.H>
+#include <AMReX_GpuContainers.H>
+#include <AMReX_Reduce.H>
+
+#include <limits>
 
 using namespace amrex;
 
@@ -78,6 +83,81 @@ void multiphase::debris_loop(
     });
 }
 
+void multiphase::interface_tiles(
+    amrex::MultiFab const& volfrac,
+    amrex::MFItInfo const& mfi_info,
+    const int nband,
+    amrex::Vector<int>& active)
+{
+    BL_PROFILE("amr-wind::multiphase::interface_tiles");
+    constexpr Real tiny = 1e-12;
+    const auto is_uniform = [](const Real vof_min, const Real vof_max) {
+        const bool empty = (vof_max <= tiny);
+        const bool full = (vof_min >= 1.0 - tiny) && (vof_max <= 1.0 + tiny);
+        return empty || full;
+    };
+
+    const int ntiles = amrex::MFIter(volfrac, mfi_info).length();
+    active.assign(ntiles, 1);
+
+    if (amrex::Gpu::notInLaunchRegion()) {
+        // Reductions over a tile do not synchronize on the host
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(volfrac, mfi_info); mfi.isValid(); ++mfi) {
+            const auto& gbx = amrex::grow(mfi.tilebox(), nband);
+            const auto& vof = volfrac.const_array(mfi);
+
+            amrex::ReduceOps<amrex::ReduceOpMin, amrex::ReduceOpMax> reduce_op;
+            amrex::ReduceData<Real, Real> reduce_data(reduce_op);
+            using ReduceTuple = typename decltype(reduce_data)::Type;
+            reduce_op.eval(
+                gbx, reduce_data,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                    return {vof(i, j, k), vof(i, j, k)};
+                });
+            const auto vof_range = reduce_data.value(reduce_op);
+            const Real vof_min = amrex::get<0>(vof_range);
+            const Real vof_max = amrex::get<1>(vof_range);
+            if (is_uniform(vof_min, vof_max)) {
+                active[mfi.LocalTileIndex()] = 0;
+            }
+        }
+        return;
+    }
+
+    // Without tiling every box is a tile, so all tiles are reduced in one
+    // kernel and copied back at once instead of synchronizing per tile
+    AMREX_ALWAYS_ASSERT(ntiles == volfrac.local_size());
+
+    // Minimum of vof and of -vof within every grown box, so that both bounds
+    // are reduced with the same atomic
+    amrex::Gpu::DeviceVector<Real> d_range(
+        2 * ntiles, std::numeric_limits<Real>::max());
+    auto* range = d_range.data();
+    const auto& vof = volfrac.const_arrays();
+    amrex::ParallelFor(
+        volfrac, amrex::IntVect(nband),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            const Real v = vof[nbx](i, j, k);
+            amrex::Gpu::Atomic::Min(&range[2 * nbx], v);
+            amrex::Gpu::Atomic::Min(&range[2 * nbx + 1], -v);
+        });
+
+    amrex::Vector<Real> h_range(2 * ntiles);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, d_range.begin(), d_range.end(),
+        h_range.begin());
+
+    for (amrex::MFIter mfi(volfrac, mfi_info); mfi.isValid(); ++mfi) {
+        const int nbx = mfi.LocalIndex();
+        if (is_uniform(h_range[2 * nbx], -h_range[2 * nbx + 1])) {
+            active[mfi.LocalTileIndex()] = 0;
+        }
+    }
+}
+
 void multiphase::sweep(
     const int dir,
     amrex::Box const& bx,
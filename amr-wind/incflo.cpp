@@ -189,6 +189,7 @@ bool incflo::regrid_and_update()
                 for (int lev = 0; lev <= finest_level; lev++) {
                     m_sim.mesh_mapping()->create_map(lev, Geom(lev));
                 }
+                m_sim.mesh_mapping()->mark_modified();
                 amrex::Print() << "done" << std::endl;
             }
         }
@@ -204,6 +205,10 @@ bool incflo::regrid_and_update()
 
         m_sim.pde_manager().fillpatch_state_fields(m_time.current_time());
 
+        // The nodal projector refers to the old grids and fields
+        m_nodal_proj.reset();
+        m_nodal_proj_sigma.clear();
+
         icns().post_regrid_actions();
         for (auto& eqn : scalar_eqns()) {
             eqn->post_regrid_actions();
@@ -289,6 +294,28 @@ void incflo::Evolve()
                               (time2 - time1) /
                               static_cast<amrex::Real>(m_cell_count)
                        << std::endl;
+        m_repo.trim_scratch_pool();
+        if (m_verbose > 0) {
+            m_repo.print_scratch_stats();
+        }
+
+        if (m_metrics) {
+            amrex::Vector<const amr_wind::Field*> fields{
+                &velocity(), &pressure(), &grad_p(), &density()};
+            for (auto& eqn : scalar_eqns()) {
+                const auto* fld = &eqn->fields().field;
+                if (fld != &density()) {
+                    fields.push_back(fld);
+                }
+            }
+            m_metrics->write_step(
+                m_time,
+                {{"pre", time1 - time0},
+                 {"solve", time2 - time1},
+                 {"post", time3 - time2},
+                 {"total", time3 - time0}},
+                fields);
+        }
     }
     amrex::Print() << "\n======================================================"
                       "========================\n"
@@ -301,6 +328,7 @@ void incflo::Evolve()
     if (m_time.write_last_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+    m_sim.io_manager().wait_for_output();
 }
 
 // Make a new level from scratch using provided BoxArray and
@@ -330,6 +358,7 @@ void incflo::MakeNewLevelFromScratch(
     // initialize the mesh map before initializing physics
     if (m_sim.has_mesh_mapping()) {
         m_sim.mesh_mapping()->create_map(lev, Geom(lev));
+        m_sim.mesh_mapping()->mark_modified();
     }
 
     for (auto& pp : m_sim.physics()) {
@@ -172,7 +172,8 @@ void incflo::ApplyPredictor(bool incremental_projection)
     Real new_time = m_time.new_time();
 
     if (m_verbose > 2) {
-        PrintMaxValues("before predictor step");
+        // New is not restored from Old for all fields at this point
+        PrintMaxValues("before predictor step", amr_wind::FieldState::Old);
     }
 
     if (m_use_godunov) {
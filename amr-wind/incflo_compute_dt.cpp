@@ -31,15 +31,19 @@ using namespace amrex;
  *  contributions from forcing term when `time.use_force_cfl` is `true` (default
  *  is `true`).
  *
+ *  All contributions are evaluated in a single pass per level that skips the
+ *  cells covered by finer levels, followed by one parallel reduction.
+ *
  */
 void incflo::ComputeDt(bool explicit_diffusion)
 {
     BL_PROFILE("amr-wind::incflo::ComputeDt");
 
-    Real conv_cfl = 0.0;
-    Real diff_cfl = 0.0;
-    Real force_cfl = 0.0;
+    // Convective, diffusive, and forcing CFL
+    Real cfl[3] = {0.0, 0.0, 0.0};
     const bool mesh_mapping = m_sim.has_mesh_mapping();
+    const bool has_vof = m_sim.pde_manager().has_pde("VOF");
+    const bool use_force_cfl = m_time.use_force_cfl();
 
     const auto& den = density();
     amr_wind::Field const* mesh_fac =
@@ -55,20 +59,30 @@ void incflo::ComputeDt(bool explicit_diffusion)
         MultiFab const& rho = den(lev);
 
         auto const& vel_arr = vel.const_arrays();
+        auto const& vf_arr = vel_force.const_arrays();
+        auto const& mu_arr = mu.const_arrays();
+        auto const& rho_arr = rho.const_arrays();
         MultiArray4<Real const> fac_arr =
             mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
                          : MultiArray4<Real const>();
-
-        Real conv_lev = 0.0;
-        Real mphase_conv_lev = 0.0;
-        Real diff_lev = 0.0;
-        Real force_lev = 0.0;
-
-        conv_lev += amrex::ParReduce(
-            TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
+        MultiArray4<Real const> vof_arr =
+            has_vof ? m_repo.get_field("vof")(lev).const_arrays()
+                    : MultiArray4<Real const>();
+        const bool has_mask = (lev < finest_level);
+        MultiArray4<int const> mask_arr =
+            has_mask ? m_repo.level_mask(lev).const_arrays()
+                     : MultiArray4<int const>();
+
+        auto cfl_lev = amrex::ParReduce(
+            TypeList<ReduceOpMax, ReduceOpMax, ReduceOpMax>{},
+            TypeList<Real, Real, Real>{}, vel, IntVect(0),
             [=] AMREX_GPU_HOST_DEVICE(
-                int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                auto const& v_bx = vel_arr[box_no];
+                int box_no, int i, int j,
+                int k) -> GpuTuple<Real, Real, Real> {
+                // Cells covered by finer levels do not contribute
+                if (has_mask && (mask_arr[box_no](i, j, k) == 0)) {
+                    return {0.0, 0.0, 0.0};
+                }
 
                 amrex::Real fac_x =
                     mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
@@ -77,115 +91,50 @@ void incflo::ComputeDt(bool explicit_diffusion)
                 amrex::Real fac_z =
                     mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
 
-                return amrex::max(
-                    amrex::Math::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x,
-                    amrex::Math::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y,
-                    amrex::Math::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z,
-                    -1.0);
-            });
-
-        if (m_sim.pde_manager().has_pde("VOF")) {
-            MultiFab const& vof = m_repo.get_field("vof")(lev);
-            auto const& vof_arr = vof.const_arrays();
-            mphase_conv_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& v_bx = vel_arr[box_no];
-                    auto const& vof_bx = vof_arr[box_no];
-
-                    // Check for interface
-                    auto is_near =
-                        amr_wind::multiphase::interface_band(i, j, k, vof_bx);
-
-                    // CFL calculation is not needed away from interface
-                    amrex::Real result = 0.0;
-                    if (is_near) {
-                        // Near interface, evaluate CFL by sum of velocities
-                        amrex::Real fac_x =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                        amrex::Real fac_y =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                        amrex::Real fac_z =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                        result = amrex::Math::abs(v_bx(i, j, k, 0)) * dxinv[0] /
-                                     fac_x +
-                                 amrex::Math::abs(v_bx(i, j, k, 1)) * dxinv[1] /
-                                     fac_y +
-                                 amrex::Math::abs(v_bx(i, j, k, 2)) * dxinv[2] /
-                                     fac_z;
-                    }
-                    return result;
-                });
-        }
-        conv_lev = amrex::max(conv_lev, mphase_conv_lev);
-
-        if (explicit_diffusion) {
-            auto const& mu_arr = mu.const_arrays();
-            auto const& rho_arr = rho.const_arrays();
-            diff_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, rho, IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& mu_bx = mu_arr[box_no];
-                    auto const& rho_bx = rho_arr[box_no];
-
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
+                auto const& v_bx = vel_arr[box_no];
+                const amrex::Real ux =
+                    amrex::Math::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x;
+                const amrex::Real uy =
+                    amrex::Math::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y;
+                const amrex::Real uz =
+                    amrex::Math::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z;
+                amrex::Real conv = amrex::max(ux, uy, uz);
+
+                // Near the interface, evaluate CFL by sum of velocities
+                if (has_vof && amr_wind::multiphase::interface_band(
+                                   i, j, k, vof_arr[box_no])) {
+                    conv = amrex::max(conv, ux + uy + uz);
+                }
+
+                amrex::Real diff = 0.0;
+                if (explicit_diffusion) {
                     const Real dxinv2 =
                         2.0 * (dxinv[0] / fac_x * dxinv[0] / fac_x +
                                dxinv[1] / fac_y * dxinv[1] / fac_y +
                                dxinv[2] / fac_z * dxinv[2] / fac_z);
+                    diff = mu_arr[box_no](i, j, k) * dxinv2 /
+                           rho_arr[box_no](i, j, k);
+                }
 
-                    return amrex::max(
-                        mu_bx(i, j, k) * dxinv2 / rho_bx(i, j, k), -1.0);
-                });
-        }
-
-        if (m_time.use_force_cfl()) {
-            auto const& vf_arr = vel_force.const_arrays();
-            force_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel_force,
-                IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
+                amrex::Real force = 0.0;
+                if (use_force_cfl) {
                     auto const& vf_bx = vf_arr[box_no];
-
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                    return amrex::max(
+                    force = amrex::max(
                         amrex::Math::abs(vf_bx(i, j, k, 0)) * dxinv[0] / fac_x,
                         amrex::Math::abs(vf_bx(i, j, k, 1)) * dxinv[1] / fac_y,
-                        amrex::Math::abs(vf_bx(i, j, k, 2)) * dxinv[2] / fac_z,
-                        -1.0);
-                });
-        }
-
-        conv_cfl = amrex::max(conv_cfl, conv_lev);
-        diff_cfl = amrex::max(diff_cfl, diff_lev);
-        force_cfl = amrex::max(force_cfl, force_lev);
-    }
+                        amrex::Math::abs(vf_bx(i, j, k, 2)) * dxinv[2] /
+                            fac_z);
+                }
 
-    ParallelAllReduce::Max<Real>(conv_cfl, ParallelContext::CommunicatorSub());
-    if (explicit_diffusion) {
-        ParallelAllReduce::Max<Real>(
-            diff_cfl, ParallelContext::CommunicatorSub());
-    }
-    if (m_time.use_force_cfl()) {
-        ParallelAllReduce::Max<Real>(
-            force_cfl, ParallelContext::CommunicatorSub());
+                return {conv, diff, force};
+            });
+
+        cfl[0] = amrex::max(cfl[0], amrex::get<0>(cfl_lev));
+        cfl[1] = amrex::max(cfl[1], amrex::get<1>(cfl_lev));
+        cfl[2] = amrex::max(cfl[2], amrex::get<2>(cfl_lev));
     }
 
-    m_time.set_current_cfl(conv_cfl, diff_cfl, force_cfl);
+    ParallelAllReduce::Max<Real>(cfl, 3, ParallelContext::CommunicatorSub());
+
+    m_time.set_current_cfl(cfl[0], cfl[1], cfl[2]);
 }
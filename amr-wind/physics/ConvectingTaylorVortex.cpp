@@ -228,33 +228,7 @@ amrex::Real ConvectingTaylorVortex::compute_error(const Field& field)
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
 
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev),
-                m_mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        if (m_sim.has_overset()) {
-            for (amrex::MFIter mfi(field(lev)); mfi.isValid(); ++mfi) {
-                const auto& vbx = mfi.validbox();
-
-                const auto& iblank_arr =
-                    m_repo.get_int_field("iblank_cell")(lev).array(mfi);
-                const auto& imask_arr = level_mask.array(mfi);
-                amrex::ParallelFor(
-                    vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        if (iblank_arr(i, j, k) < 1) {
-                            imask_arr(i, j, k) = 0;
-                        }
-                    });
-            }
-        }
+        const auto& level_mask = m_repo.level_mask(lev);
 
         const auto& dx = m_mesh.Geom(lev).CellSizeArray();
         const auto& prob_lo = m_mesh.Geom(lev).ProbLoArray();
@@ -262,6 +236,12 @@ amrex::Real ConvectingTaylorVortex::compute_error(const Field& field)
         const auto& fld = field(lev);
         auto const& fld_arr = fld.const_arrays();
         auto const& mask_arr = level_mask.const_arrays();
+        // Blanked overset cells are excluded as well
+        const bool has_overset = m_sim.has_overset();
+        amrex::MultiArray4<int const> iblank_arr =
+            has_overset
+                ? m_repo.get_int_field("iblank_cell")(lev).const_arrays()
+                : amrex::MultiArray4<int const>();
         amrex::MultiArray4<amrex::Real const> fac_arr =
             mesh_mapping ? ((*mesh_fac_cc)(lev).const_arrays())
                          : amrex::MultiArray4<amrex::Real const>();
@@ -275,7 +255,10 @@ amrex::Real ConvectingTaylorVortex::compute_error(const Field& field)
             [=] AMREX_GPU_HOST_DEVICE(int box_no, int i, int j, int k)
                 -> amrex::GpuTuple<amrex::Real> {
                 auto const& fld_bx = fld_arr[box_no];
-                auto const& mask_bx = mask_arr[box_no];
+                const int mask =
+                    (has_overset && (iblank_arr[box_no](i, j, k) < 1))
+                        ? 0
+                        : mask_arr[box_no](i, j, k);
 
                 amrex::Real x = mesh_mapping ? (nu_cc[box_no](i, j, k, 0))
                                              : (prob_lo[0] + (i + 0.5) * dx[0]);
@@ -293,8 +276,7 @@ amrex::Real ConvectingTaylorVortex::compute_error(const Field& field)
                 const amrex::Real cell_vol =
                     dx[0] * fac_x * dx[1] * fac_y * dx[2] * fac_z;
 
-                return cell_vol * mask_bx(i, j, k) * (u - u_exact) *
-                       (u - u_exact);
+                return cell_vol * mask * (u - u_exact) * (u - u_exact);
             });
     }
 
@@ -75,10 +75,11 @@ void MultiPhase::post_init_actions()
         };
     }
 
-    q0 = momentum_sum(0);
-    q1 = momentum_sum(1);
-    q2 = momentum_sum(2);
-    sumvof0 = volume_fraction_sum();
+    const auto sums = volume_momentum_sums();
+    sumvof0 = sums[0];
+    q0 = sums[1];
+    q1 = sums[2];
+    q2 = sums[3];
 }
 
 void MultiPhase::pre_advance_work()
@@ -103,10 +104,11 @@ void MultiPhase::post_advance_work()
     case InterfaceCapturingMethod::VOF:
         // Compute and print the total volume fraction, momenta, and differences
         if (m_verbose > 0) {
-            m_total_volfrac = volume_fraction_sum();
-            amrex::Real mom_x = momentum_sum(0) - q0;
-            amrex::Real mom_y = momentum_sum(1) - q1;
-            amrex::Real mom_z = momentum_sum(2) - q2;
+            const auto sums = volume_momentum_sums();
+            m_total_volfrac = sums[0];
+            amrex::Real mom_x = sums[1] - q0;
+            amrex::Real mom_y = sums[2] - q1;
+            amrex::Real mom_z = sums[3] - q2;
             const auto& geom = m_sim.mesh().Geom();
             const amrex::Real total_vol = geom[0].ProbDomain().volume();
             amrex::Print() << "Volume of Fluid diagnostics:" << std::endl;
@@ -127,101 +129,41 @@ void MultiPhase::post_advance_work()
     };
 }
 
-amrex::Real MultiPhase::volume_fraction_sum()
+amrex::GpuArray<amrex::Real, 4> MultiPhase::volume_momentum_sums()
 {
-    using namespace amrex;
-    BL_PROFILE("amr-wind::multiphase::ComputeVolumeFractionSum");
+    BL_PROFILE("amr-wind::multiphase::ComputeVolumeMomentumSums");
     const int nlevels = m_sim.repo().num_active_levels();
     const auto& geom = m_sim.mesh().Geom();
-    const auto& mesh = m_sim.mesh();
 
-    amrex::Real total_volume_frac = 0.0;
+    amrex::GpuArray<amrex::Real, 4> sums = {{0.0, 0.0, 0.0, 0.0}};
 
     for (int lev = 0; lev < nlevels; ++lev) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        auto& vof = (*m_vof)(lev);
+        const auto& vof_arr = (*m_vof)(lev).const_arrays();
+        const auto& vel_arr = m_velocity(lev).const_arrays();
+        const auto& dens_arr = m_density(lev).const_arrays();
         const amrex::Real cell_vol = geom[lev].CellSize()[0] *
                                      geom[lev].CellSize()[1] *
                                      geom[lev].CellSize()[2];
 
-        total_volume_frac += amrex::ReduceSum(
-            vof, level_mask, 0,
+        const auto lev_sums = field_ops::masked_level_sum<4>(
+            m_sim.repo(), lev,
             [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& volfrac,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real vol_fab = 0.0;
-                amrex::Loop(bx, [=, &vol_fab](int i, int j, int k) noexcept {
-                    vol_fab += volfrac(i, j, k) * mask_arr(i, j, k) * cell_vol;
-                });
-                return vol_fab;
+                int nbx, int i, int j, int k,
+                amrex::GpuArray<amrex::Real, 4>& qty) noexcept {
+                const amrex::Real mass = dens_arr[nbx](i, j, k) * cell_vol;
+                qty[0] = vof_arr[nbx](i, j, k) * cell_vol;
+                qty[1] = vel_arr[nbx](i, j, k, 0) * mass;
+                qty[2] = vel_arr[nbx](i, j, k, 1) * mass;
+                qty[3] = vel_arr[nbx](i, j, k, 2) * mass;
             });
-    }
-    amrex::ParallelDescriptor::ReduceRealSum(total_volume_frac);
-
-    return total_volume_frac;
-}
-
-amrex::Real MultiPhase::momentum_sum(int n)
-{
-    using namespace amrex;
-    BL_PROFILE("amr-wind::multiphase::ComputeVolumeFractionSum");
-    const int nlevels = m_sim.repo().num_active_levels();
-    const auto& geom = m_sim.mesh().Geom();
-    const auto& mesh = m_sim.mesh();
-
-    amrex::Real total_momentum = 0.0;
-
-    for (int lev = 0; lev < nlevels; ++lev) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
+        for (int n = 0; n < 4; ++n) {
+            sums[n] += lev_sums[n];
         }
-
-        auto& velocity = m_sim.repo().get_field("velocity")(lev);
-        auto& density = m_sim.repo().get_field("density")(lev);
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        total_momentum += amrex::ReduceSum(
-            velocity, density, level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& vel,
-                amrex::Array4<amrex::Real const> const& dens,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real vol_fab = 0.0;
-                amrex::Loop(bx, [=, &vol_fab](int i, int j, int k) noexcept {
-                    vol_fab += vel(i, j, k, n) * dens(i, j, k) *
-                               mask_arr(i, j, k) * cell_vol;
-                });
-                return vol_fab;
-            });
     }
-    amrex::ParallelDescriptor::ReduceRealSum(total_momentum);
+    amrex::ParallelAllReduce::Sum(
+        sums.data(), 4, amrex::ParallelContext::CommunicatorSub());
 
-    return total_momentum;
+    return sums;
 }
 
 void MultiPhase::set_density_via_levelset()
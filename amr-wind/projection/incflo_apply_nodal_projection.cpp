@@ -88,6 +88,15 @@ incflo::get_projection_bc(Orientation::Side side) const noexcept
  *  - If `incremental == true`, then the pressure term is not added to
  *    \f$u^{**}\f$ and the update is in delta-form.
  *
+ *  - The projector is built once per grid generation with coefficients that
+ *    do not include `scaling_factor`. The solution is then `scaling_factor`
+ *    times \f$\phi\f$, which leaves the velocity update unchanged and is
+ *    rescaled when updating the pressure. Only the coefficients are
+ *    refreshed for variable density.
+ *
+ *  - With `nodal_proj.warm_start`, non-incremental solves start from the
+ *    pressure extrapolated from the previous solves.
+ *
  *  Please consult [AMReX Linear
  *  Solvers](https://amrex-codes.github.io/amrex/docs_html/LinearSolvers.html#nodal-projection)
  *  documentation for more information on the nodal projection operator.
@@ -239,14 +248,30 @@ void incflo::ApplyProjection(
         velocity.to_uniform_space();
     }
 
+    const amrex::Real setup_start = amrex::ParallelDescriptor::second();
+
+    // The overset mask can change every time step, so the projector is only
+    // reused without overset
+    if (m_sim.has_overset()) {
+        m_nodal_proj.reset();
+    }
+    const bool need_init = !m_nodal_proj;
+
     // Create sigma while accounting for mesh mapping
-    // sigma = 1/(fac^2)*J * dt/rho
-    Vector<amrex::MultiFab> sigma(finest_level + 1);
-    if (variable_density || mesh_mapping) {
+    // sigma = 1/(fac^2)*J/rho
+    const bool has_sigma = variable_density || mesh_mapping;
+    auto& sigma = m_nodal_proj_sigma;
+    if (has_sigma) {
         int ncomp = mesh_mapping ? AMREX_SPACEDIM : 1;
+        if (need_init) {
+            sigma.clear();
+            sigma.resize(finest_level + 1);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                sigma[lev].define(
+                    grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
+            }
+        }
         for (int lev = 0; lev <= finest_level; ++lev) {
-            sigma[lev].define(
-                grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
@@ -269,16 +294,14 @@ void incflo::ApplyProjection(
                             mesh_mapping ? (fac(i, j, k, n)) : 1.0;
                         amrex::Real det_j =
                             mesh_mapping ? (detJ(i, j, k)) : 1.0;
-                        sig(i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
-                                          scaling_factor / rho(i, j, k);
+                        sig(i, j, k, n) =
+                            std::pow(fac_cc, -2.) * det_j / rho(i, j, k);
                     });
             }
         }
     }
 
     // Perform projection
-    std::unique_ptr<Hydro::NodalProjector> nodal_projector;
-
     auto bclo = get_projection_bc(Orientation::low);
     auto bchi = get_projection_bc(Orientation::high);
 
@@ -293,23 +316,29 @@ void incflo::ApplyProjection(
 
     amr_wind::MLMGOptions options("nodal_proj");
 
-    if (variable_density || mesh_mapping) {
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
-            options.lpinfo());
-    } else {
-        amrex::Real rho_0 = 1.0;
-        amrex::ParmParse pp("incflo");
-        pp.query("density", rho_0);
+    if (need_init) {
+        if (has_sigma) {
+            m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+                vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
+                options.lpinfo());
+        } else {
+            amrex::Real rho_0 = 1.0;
+            amrex::ParmParse pp("incflo");
+            pp.query("density", rho_0);
 
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, scaling_factor / rho_0, Geom(0, finest_level),
-            options.lpinfo());
-    }
+            m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+                vel, 1.0 / rho_0, Geom(0, finest_level), options.lpinfo());
+        }
 
-    // Set MLMG and NodalProjector options
-    options(*nodal_projector);
-    nodal_projector->setDomainBC(bclo, bchi);
+        // Set MLMG and NodalProjector options
+        options(*m_nodal_proj);
+        m_nodal_proj->setDomainBC(bclo, bchi);
+    } else if (has_sigma) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            m_nodal_proj->getLinOp().setSigma(lev, sigma[lev]);
+        }
+    }
+    auto* nodal_projector = m_nodal_proj.get();
 
     bool has_ib = m_sim.physics_manager().contains("IB");
     if (has_ib) {
@@ -336,23 +365,43 @@ void incflo::ApplyProjection(
         }
     }
 
-    if (m_sim.has_overset()) {
+    const amrex::Real rel_tol = options.solve_rel_tol(m_time.current_cfl());
+    const bool warm_start = options.warm_start && !incremental;
+    if (m_sim.has_overset() || warm_start) {
         auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::NODE);
-        if (incremental) {
+        for (int lev = 0; lev <= finestLevel(); ++lev) {
+            (*phif)(lev).setVal(0.0);
+        }
+        bool has_guess = false;
+        if (!incremental) {
+            has_guess =
+                warm_start &&
+                m_pressure_history.extrapolate(phif->vec_ptrs(), time);
+            if (!has_guess && m_sim.has_overset()) {
+                amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
+                has_guess = true;
+            }
+        }
+        if (has_guess) {
             for (int lev = 0; lev <= finestLevel(); ++lev) {
-                (*phif)(lev).setVal(0.0);
+                (*phif)(lev).mult(scaling_factor, 0, 1, 1);
             }
-        } else {
-            amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
         }
 
-        nodal_projector->project(
-            phif->vec_ptrs(), options.rel_tol, options.abs_tol);
+        const amrex::Real solve_start = amrex::ParallelDescriptor::second();
+        nodal_projector->project(phif->vec_ptrs(), rel_tol, options.abs_tol);
+        amr_wind::io::print_mlmg_info(
+            "Nodal_projection", nodal_projector->getMLMG(),
+            solve_start - setup_start,
+            amrex::ParallelDescriptor::second() - solve_start);
     } else {
-        nodal_projector->project(options.rel_tol, options.abs_tol);
+        const amrex::Real solve_start = amrex::ParallelDescriptor::second();
+        nodal_projector->project(rel_tol, options.abs_tol);
+        amr_wind::io::print_mlmg_info(
+            "Nodal_projection", nodal_projector->getMLMG(),
+            solve_start - setup_start,
+            amrex::ParallelDescriptor::second() - solve_start);
     }
-    amr_wind::io::print_mlmg_info(
-        "Nodal_projection", nodal_projector->getMLMG());
 
     // scale U^* back to -> U = fac/J * U^bar
     if (mesh_mapping) {
@@ -367,9 +416,10 @@ void incflo::ApplyProjection(
         }
     }
 
-    // Get phi and fluxes
+    // Get phi and fluxes, the solution includes the scaling factor
     auto phi = nodal_projector->getPhi();
     auto gradphi = nodal_projector->getGradPhi();
+    const amrex::Real inv_scaling = 1.0 / scaling_factor;
 
     for (int lev = 0; lev <= finest_level; lev++) {
 
@@ -387,21 +437,21 @@ void incflo::ApplyProjection(
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) += gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) += gp_proj(i, j, k, n) * inv_scaling;
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) += p_proj(i, j, k);
+                        p_lev(i, j, k) += p_proj(i, j, k) * inv_scaling;
                     });
             } else {
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) = gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) = gp_proj(i, j, k, n) * inv_scaling;
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) = p_proj(i, j, k);
+                        p_lev(i, j, k) = p_proj(i, j, k) * inv_scaling;
                     });
             }
         }
@@ -412,6 +462,10 @@ void incflo::ApplyProjection(
             grad_p(lev + 1), grad_p(lev), 0, AMREX_SPACEDIM, refRatio(lev));
     }
 
+    if (warm_start) {
+        m_pressure_history.store(pressure.vec_const_ptrs(), time);
+    }
+
     velocity.fillpatch(m_time.new_time());
     if (m_verbose > 2) {
         if (proj_for_small_dt) {
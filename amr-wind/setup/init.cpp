@@ -61,6 +61,23 @@ void incflo::ReadParameters()
         // for all other physics
         pp.query("probtype", m_probtype);
 
+        pp.query("scratch_field_pool", m_repo.use_scratch_pool());
+        amrex::Real scratch_pool_max_mb = -1.0;
+        pp.query("scratch_field_pool_max_mb", scratch_pool_max_mb);
+        if (scratch_pool_max_mb >= 0.0) {
+            m_repo.scratch_pool_max_bytes() = static_cast<amrex::Long>(
+                scratch_pool_max_mb * 1024.0 * 1024.0);
+        }
+
+        std::string metrics_file;
+        int metrics_interval = 1;
+        pp.query("metrics_file", metrics_file);
+        pp.query("metrics_interval", metrics_interval);
+        if (!metrics_file.empty()) {
+            m_metrics = std::make_unique<amr_wind::MetricsLog>(
+                metrics_file, metrics_interval);
+        }
+
     } // end prefix incflo
 }
 
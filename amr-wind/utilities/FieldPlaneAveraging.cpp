@@ -1,7 +1,10 @@
 #include "amr-wind/utilities/FieldPlaneAveraging.H"
+#include "amr-wind/utilities/tile_line_sums.H"
 
 #include <algorithm>
 
+#include "AMReX_ParmParse.H"
+
 namespace amr_wind {
 
 template <typename FType>
@@ -48,6 +51,9 @@ FPlaneAveraging<FType>::FPlaneAveraging(
     for (int i = 0; i < m_ncell_line; ++i) {
         m_line_xcentroid[i] = m_xlo + (i + 0.5) * m_dx;
     }
+
+    amrex::ParmParse pp("incflo");
+    pp.query("deterministic_plane_averaging", m_deterministic);
 }
 
 template <typename FType>
@@ -261,6 +267,22 @@ void FPlaneAveraging<FType>::compute_averages(
 
     const amrex::Real denom = 1.0 / (amrex::Real)m_ncell_plane;
 
+    if (m_deterministic) {
+        const auto& farrs = mfab.const_arrays();
+        tile_line_sums(
+            idxOp, mfab, m_ncomp,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                return farrs[nbx](i, j, k, n);
+            },
+            m_line_average);
+        amrex::ParallelDescriptor::ReduceRealSum(
+            m_line_average.data(), m_line_average.size());
+        std::for_each(
+            m_line_average.begin(), m_line_average.end(),
+            [denom](amrex::Real& el) { el *= denom; });
+        return;
+    }
+
     amrex::AsyncArray<amrex::Real> lavg(
         m_line_average.data(), m_line_average.size());
 
@@ -370,6 +392,26 @@ void VelPlaneAveraging::compute_hvelmag_averages(
 
     const amrex::Real denom = 1.0 / (amrex::Real)m_ncell_plane;
 
+    if (m_deterministic) {
+        const auto& farrs = mfab.const_arrays();
+        tile_line_sums(
+            idx_op, mfab, 1,
+            [=] AMREX_GPU_DEVICE(
+                int nbx, int i, int j, int k, int /*n*/) noexcept {
+                const auto& arr = farrs[nbx];
+                return std::sqrt(
+                    arr(i, j, k, h1_idx) * arr(i, j, k, h1_idx) +
+                    arr(i, j, k, h2_idx) * arr(i, j, k, h2_idx));
+            },
+            m_line_hvelmag_average);
+        amrex::ParallelDescriptor::ReduceRealSum(
+            m_line_hvelmag_average.data(), m_line_hvelmag_average.size());
+        std::for_each(
+            m_line_hvelmag_average.begin(), m_line_hvelmag_average.end(),
+            [denom](amrex::Real& el) { el *= denom; });
+        return;
+    }
+
     amrex::AsyncArray<amrex::Real> lavg(
         m_line_hvelmag_average.data(), m_line_hvelmag_average.size());
     amrex::Real* line_avg = lavg.data();
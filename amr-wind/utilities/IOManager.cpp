@@ -12,6 +12,7 @@
 #include "amr-wind/utilities/DerivedQtyDefs.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
+#include "AMReX_AsyncOut.H"
 #include "AMReX_ParmParse.H"
 #include "AMReX_PlotFileUtil.H"
 #include "AMReX_MultiFabUtil.H"
@@ -44,6 +45,7 @@ void IOManager::initialize_io()
     pp.query("check_file", m_chk_prefix);
     pp.query("restart_file", m_restart_file);
     pp.query("allow_missing_restart_fields", m_allow_missing_restart_fields);
+    pp.query("async_max_pending", m_async_max_pending);
 #ifdef AMR_WIND_USE_HDF5
     pp.query("output_hdf5_plotfile", m_output_hdf5_plotfile);
 #ifdef AMR_WIND_USE_HDF5_ZFP
@@ -57,6 +59,30 @@ void IOManager::initialize_io()
     pp.queryarr("derived_outputs", out_derived_vars);
     pp.queryarr("skip_outputs", out_skip_vars);
 
+    std::string plot_precision{"double"};
+    pp.query("plot_precision", plot_precision);
+    if ((plot_precision != "double") && (plot_precision != "float")) {
+        amrex::Abort("IOManager: invalid plot precision: " + plot_precision);
+    }
+    m_plt_single_prec = (plot_precision == "float");
+    // The asynchronous writer always uses the native floating point format
+    if (m_plt_single_prec && amrex::AsyncOut::UseAsyncOut()) {
+        amrex::Print() << "WARNING: io.plot_precision = float is not supported "
+                          "with amrex.async_out, plot files are written in "
+                          "double precision"
+                       << std::endl;
+        m_plt_single_prec = false;
+    }
+#ifdef AMR_WIND_USE_HDF5
+    if (m_plt_single_prec && m_output_hdf5_plotfile) {
+        amrex::Print() << "WARNING: io.plot_precision = float is not supported "
+                          "with io.output_hdf5_plotfile, plot files are "
+                          "written in double precision"
+                       << std::endl;
+        m_plt_single_prec = false;
+    }
+#endif
+
     // We process the input vector to eliminate duplicates
     for (const auto& name : out_vars) {
         outputs.insert(name);
@@ -128,6 +154,11 @@ void IOManager::write_plot_file()
 {
     BL_PROFILE("amr-wind::IOManager::write_plot_file");
 
+    // Bound the number of snapshots held by the asynchronous writer
+    if (m_num_pending >= m_async_max_pending) {
+        wait_for_output();
+    }
+
     amrex::Vector<int> istep(
         m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
     const int plt_comp = m_plt_num_comp;
@@ -172,10 +203,20 @@ void IOManager::write_plot_file()
         );
     } else {
 #endif
+        const auto fab_format = amrex::FArrayBox::getFormat();
+        if (m_plt_single_prec) {
+            amrex::FArrayBox::setFormat(amrex::FABio::FAB_NATIVE_32);
+        }
+        // With `amrex.async_out` the data is copied to staging buffers and
+        // written by a background thread after this call returns
         amrex::WriteMultiLevelPlotfile(
             plt_filename, nlevels, outfield->vec_const_ptrs(), m_plt_var_names,
             mesh.Geom(), m_sim.time().new_time(), istep, mesh.refRatio());
+        amrex::FArrayBox::setFormat(fab_format);
         write_info_file(plt_filename);
+        if (amrex::AsyncOut::UseAsyncOut()) {
+            ++m_num_pending;
+        }
 #ifdef AMR_WIND_USE_HDF5
     }
 #endif
@@ -184,6 +225,11 @@ void IOManager::write_plot_file()
 void IOManager::write_checkpoint_file(const int start_level)
 {
     BL_PROFILE("amr-wind::IOManager::write_checkpoint_file");
+
+    // Ensure all earlier outputs, in particular the previous checkpoint, are
+    // complete on disk before starting a new checkpoint
+    wait_for_output();
+
     const std::string level_prefix = "Level_";
     const std::string chkname =
         amrex::Concatenate(m_chk_prefix, m_sim.time().time_index());
@@ -196,15 +242,31 @@ void IOManager::write_checkpoint_file(const int start_level)
     write_header(chkname, start_level);
     write_info_file(chkname);
 
+    const bool async_out = amrex::AsyncOut::UseAsyncOut();
     for (int lev = start_level; lev < mesh.finestLevel() + 1; ++lev) {
         for (auto* fld : m_chk_fields) {
             auto& field = *fld;
-            amrex::VisMF::Write(
-                field(lev),
-                amrex::MultiFabFileFullPrefix(
-                    lev - start_level, chkname, level_prefix, field.name()));
+            const auto fab_file = amrex::MultiFabFileFullPrefix(
+                lev - start_level, chkname, level_prefix, field.name());
+            if (async_out) {
+                amrex::VisMF::AsyncWrite(field(lev), fab_file);
+            } else {
+                amrex::VisMF::Write(field(lev), fab_file);
+            }
         }
     }
+    if (async_out) {
+        ++m_num_pending;
+    }
+}
+
+void IOManager::wait_for_output()
+{
+    if (m_num_pending > 0) {
+        BL_PROFILE("amr-wind::IOManager::wait_for_output");
+        amrex::AsyncOut::Wait();
+        m_num_pending = 0;
+    }
 }
 
 void IOManager::read_checkpoint_fields(
@@ -0,0 +1,124 @@
+#include "amr-wind/utilities/MetricsLog.H"
+#include "amr-wind/utilities/diagnostics.H"
+#include "amr-wind/core/Field.H"
+#include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/core/SimTime.H"
+
+#include "AMReX.H"
+#include "AMReX_ParallelDescriptor.H"
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+namespace amr_wind {
+
+namespace {
+
+//! JSON has no representation for NaN and infinity
+void write_number(std::ostream& out, const amrex::Real val)
+{
+    if (std::isfinite(val)) {
+        out << val;
+    } else {
+        out << "null";
+    }
+}
+
+template <typename T>
+void write_array(std::ostream& out, const amrex::Vector<T>& vals)
+{
+    out << "[";
+    for (int i = 0; i < static_cast<int>(vals.size()); ++i) {
+        if (i > 0) {
+            out << ",";
+        }
+        write_number(out, static_cast<amrex::Real>(vals[i]));
+    }
+    out << "]";
+}
+
+} // namespace
+
+MetricsLog::MetricsLog(const std::string& filename, const int interval)
+    : m_interval(amrex::max(interval, 1))
+{
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        m_out.open(filename, std::ios::out | std::ios::app);
+        if (!m_out.good()) {
+            amrex::Abort("MetricsLog: cannot open file " + filename);
+        }
+        m_out << std::setprecision(std::numeric_limits<amrex::Real>::digits10);
+    }
+}
+
+void MetricsLog::write_step(
+    const SimTime& time,
+    const TimingList& timings,
+    const amrex::Vector<const Field*>& fields)
+{
+    if ((time.time_index() % m_interval) != 0) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::MetricsLog::write_step");
+    amrex::Vector<const amrex::MultiFab*> mfs;
+    for (const auto* fld : fields) {
+        for (int lev = 0; lev < fld->repo().num_active_levels(); ++lev) {
+            mfs.push_back(&(*fld)(lev));
+        }
+    }
+    const auto stats = diagnostics::compute_stats(mfs);
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    auto& out = m_out;
+    out << "{\"step\":" << time.time_index() << ",\"time\":";
+    write_number(out, time.new_time());
+    out << ",\"dt\":";
+    write_number(out, time.deltaT());
+    out << ",\"cfl\":";
+    write_number(out, time.current_cfl());
+
+    out << ",\"wallclock\":{";
+    for (int i = 0; i < static_cast<int>(timings.size()); ++i) {
+        out << (i > 0 ? "," : "") << "\"" << timings[i].first << "\":";
+        write_number(out, timings[i].second);
+    }
+    out << "}";
+
+    // Combine the statistics of all levels of a field
+    out << ",\"fields\":{";
+    int idx = 0;
+    for (int i = 0; i < static_cast<int>(fields.size()); ++i) {
+        const int ncomp = fields[i]->num_comp();
+        amrex::Vector<amrex::Real> fmin(
+            ncomp, std::numeric_limits<amrex::Real>::max());
+        amrex::Vector<amrex::Real> fmax(
+            ncomp, std::numeric_limits<amrex::Real>::lowest());
+        amrex::Vector<int> fnan(ncomp, 0);
+        const int nlevels = fields[i]->repo().num_active_levels();
+        for (int lev = 0; lev < nlevels; ++lev) {
+            const auto& st = stats[idx++];
+            for (int n = 0; n < ncomp; ++n) {
+                fmin[n] = amrex::min(fmin[n], st.min[n]);
+                fmax[n] = amrex::max(fmax[n], st.max[n]);
+                fnan[n] = amrex::max(fnan[n], st.has_nan[n]);
+            }
+        }
+
+        out << (i > 0 ? "," : "") << "\"" << fields[i]->name()
+            << "\":{\"min\":";
+        write_array(out, fmin);
+        out << ",\"max\":";
+        write_array(out, fmax);
+        out << ",\"nan\":";
+        write_array(out, fnan);
+        out << "}";
+    }
+    out << "}}" << std::endl;
+}
+
+} // namespace amr_wind
@@ -1,4 +1,7 @@
 #include "SecondMomentAveraging.H"
+#include "amr-wind/utilities/tile_line_sums.H"
+
+#include <algorithm>
 
 namespace amr_wind {
 
@@ -126,10 +129,6 @@ void SecondMomentAveraging::compute_average(
 
     BL_PROFILE("amr-wind::SecondMomentAveraging::compute_average");
 
-    amrex::AsyncArray<amrex::Real> lfluc(
-        m_second_moments_line.data(), m_second_moments_line.size());
-    amrex::Real* line_fluc = lfluc.data();
-
     amrex::AsyncArray<amrex::Real> lavg1(
         m_plane_average1.line_average().data(),
         m_plane_average1.line_average().size());
@@ -146,6 +145,32 @@ void SecondMomentAveraging::compute_average(
     const int ncomp2 = m_plane_average2.ncomp();
     const int nmoments = m_num_moments;
 
+    if (m_plane_average1.deterministic()) {
+        const auto& farrs1 = mfab1.const_arrays();
+        const auto& farrs2 = mfab2.const_arrays();
+        tile_line_sums(
+            idxOp, mfab1, nmoments,
+            [=] AMREX_GPU_DEVICE(
+                int nbx, int i, int j, int k, int nf) noexcept {
+                const int ind = idxOp(i, j, k);
+                const int m = nf / ncomp2;
+                const int n = nf % ncomp2;
+                return (farrs1[nbx](i, j, k, m) - line_avg1[ncomp1 * ind + m]) *
+                       (farrs2[nbx](i, j, k, n) - line_avg2[ncomp2 * ind + n]);
+            },
+            m_second_moments_line);
+        amrex::ParallelDescriptor::ReduceRealSum(
+            m_second_moments_line.data(), m_second_moments_line.size());
+        std::for_each(
+            m_second_moments_line.begin(), m_second_moments_line.end(),
+            [denom](amrex::Real& el) { el *= denom; });
+        return;
+    }
+
+    amrex::AsyncArray<amrex::Real> lfluc(
+        m_second_moments_line.data(), m_second_moments_line.size());
+    amrex::Real* line_fluc = lfluc.data();
+
 #ifdef _OPENMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -1,4 +1,7 @@
 #include "ThirdMomentAveraging.H"
+#include "amr-wind/utilities/tile_line_sums.H"
+
+#include <algorithm>
 
 namespace amr_wind {
 
@@ -144,10 +147,6 @@ void ThirdMomentAveraging::compute_average(
 
     BL_PROFILE("amr-wind::ThirdMomentAveraging::compute_average");
 
-    amrex::AsyncArray<amrex::Real> lfluc(
-        m_third_moments_line.data(), m_third_moments_line.size());
-    amrex::Real* line_fluc = lfluc.data();
-
     amrex::AsyncArray<amrex::Real> lavg1(
         m_plane_average1.line_average().data(),
         m_plane_average1.line_average().size());
@@ -169,6 +168,35 @@ void ThirdMomentAveraging::compute_average(
     const int ncomp3 = m_plane_average3.ncomp();
     const int nmoments = m_num_moments;
 
+    if (m_plane_average1.deterministic()) {
+        const auto& farrs1 = mfab1.const_arrays();
+        const auto& farrs2 = mfab2.const_arrays();
+        const auto& farrs3 = mfab3.const_arrays();
+        tile_line_sums(
+            idxOp, mfab1, nmoments,
+            [=] AMREX_GPU_DEVICE(
+                int nbx, int i, int j, int k, int nf) noexcept {
+                const int ind = idxOp(i, j, k);
+                const int m = nf / (ncomp2 * ncomp3);
+                const int n = (nf / ncomp3) % ncomp2;
+                const int p = nf % ncomp3;
+                return (farrs1[nbx](i, j, k, m) - line_avg1[ncomp1 * ind + m]) *
+                       (farrs2[nbx](i, j, k, n) - line_avg2[ncomp2 * ind + n]) *
+                       (farrs3[nbx](i, j, k, p) - line_avg3[ncomp3 * ind + p]);
+            },
+            m_third_moments_line);
+        amrex::ParallelDescriptor::ReduceRealSum(
+            m_third_moments_line.data(), m_third_moments_line.size());
+        std::for_each(
+            m_third_moments_line.begin(), m_third_moments_line.end(),
+            [denom](amrex::Real& el) { el *= denom; });
+        return;
+    }
+
+    amrex::AsyncArray<amrex::Real> lfluc(
+        m_third_moments_line.data(), m_third_moments_line.size());
+    amrex::Real* line_fluc = lfluc.data();
+
 #ifdef _OPENMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -0,0 +1,168 @@
+#include "amr-wind/utilities/ascent/BlueprintStager.H"
+
+#include "AMReX.H"
+#include "AMReX_Print.H"
+
+#include <conduit.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace amr_wind {
+namespace ascent_int {
+
+BlueprintStager::BlueprintStager(
+    const std::string& socket_path,
+    const int rank,
+    const int num_ranks,
+    const int num_buffers,
+    const std::vector<std::string>& ghost_field_names)
+    : m_rank(rank)
+    , m_num_ranks(num_ranks)
+    , m_num_buffers(static_cast<std::size_t>(std::max(num_buffers, 1)))
+{
+    sockaddr_un addr{};
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        amrex::Abort("BlueprintStager: socket path too long: " + socket_path);
+    }
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    for (const auto& gname : ghost_field_names) {
+        m_ghost_names += gname + "\n";
+    }
+
+    m_sock = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_sock < 0) {
+        amrex::Abort(
+            "BlueprintStager: cannot create socket: " +
+            std::string(std::strerror(errno)));
+    }
+
+    if (::connect(
+            m_sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        const std::string msg = std::strerror(errno);
+        ::close(m_sock);
+        amrex::Abort(
+            "BlueprintStager: cannot connect to in-situ consumer at " +
+            socket_path + ": " + msg);
+    }
+
+    m_thread = std::thread(&BlueprintStager::sender_loop, this);
+}
+
+BlueprintStager::~BlueprintStager()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_done = true;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    if (m_sock >= 0) {
+        ::close(m_sock);
+    }
+}
+
+void BlueprintStager::stage(const conduit::Node& mesh, const int cycle)
+{
+    BL_PROFILE("amr-wind::BlueprintStager::stage");
+
+    if (m_failed) {
+        amrex::Print() << "WARNING: BlueprintStager: connection to in-situ "
+                          "consumer lost, skipping output"
+                       << std::endl;
+        return;
+    }
+
+    // Wait for a free staging buffer
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] {
+            return (m_queue.size() < m_num_buffers) || m_failed;
+        });
+    }
+
+    // Serialize outside the lock so that the sender can continue draining
+    auto buf = std::make_unique<StagedData>();
+    conduit::Schema compact_schema;
+    mesh.schema().compact_to(compact_schema);
+    buf->schema = compact_schema.to_json();
+    mesh.serialize(buf->data);
+
+    buf->header.rank = static_cast<std::uint64_t>(m_rank);
+    buf->header.num_ranks = static_cast<std::uint64_t>(m_num_ranks);
+    buf->header.cycle = static_cast<std::uint64_t>(cycle);
+    buf->header.schema_bytes = buf->schema.size();
+    buf->header.ghost_bytes = m_ghost_names.size();
+    buf->header.data_bytes = buf->data.size();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(buf));
+    }
+    m_cv.notify_all();
+}
+
+void BlueprintStager::wait_all()
+{
+    BL_PROFILE("amr-wind::BlueprintStager::wait_all");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return m_queue.empty() || m_failed; });
+}
+
+void BlueprintStager::sender_loop()
+{
+    while (true) {
+        StagedData* buf = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return !m_queue.empty() || m_done; });
+            if (m_queue.empty()) return;
+            buf = m_queue.front().get();
+        }
+
+        const bool ok =
+            send_bytes(&buf->header, sizeof(buf->header)) &&
+            send_bytes(buf->schema.data(), buf->schema.size()) &&
+            send_bytes(m_ghost_names.data(), m_ghost_names.size()) &&
+            send_bytes(buf->data.data(), buf->data.size());
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (ok) {
+                m_queue.pop_front();
+            } else {
+                m_failed = true;
+                m_queue.clear();
+            }
+        }
+        m_cv.notify_all();
+
+        if (!ok) return;
+    }
+}
+
+bool BlueprintStager::send_bytes(const void* buf, std::size_t nbytes)
+{
+    const auto* ptr = static_cast<const char*>(buf);
+    while (nbytes > 0) {
+        const auto nsent = ::send(m_sock, ptr, nbytes, MSG_NOSIGNAL);
+        if (nsent < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        ptr += nsent;
+        nbytes -= static_cast<std::size_t>(nsent);
+    }
+    return true;
+}
+
+} // namespace ascent_int
+} // namespace amr_wind
@@ -1,4 +1,5 @@
 #include "ascent.H"
+#include "amr-wind/utilities/ascent/BlueprintStager.H"
 
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/io_utils.H"
@@ -8,14 +9,45 @@
 
 #include <ascent.hpp>
 
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
 namespace amr_wind {
 namespace ascent_int {
 
+namespace {
+std::string domain_name(const int domain_id)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "domain_%06d", domain_id);
+    return buf;
+}
+
+std::string topo_name(const int ngrow)
+{
+    return "topo_ng" + std::to_string(ngrow);
+}
+
+std::string ghost_name(const int ngrow)
+{
+    return "ascent_ghosts_ng" + std::to_string(ngrow);
+}
+} // namespace
+
 AscentPostProcess::AscentPostProcess(CFDSim& sim, const std::string& label)
     : m_sim(sim), m_label(label)
 {}
 
-AscentPostProcess::~AscentPostProcess() = default;
+AscentPostProcess::~AscentPostProcess()
+{
+    // Flush any meshes still being sent to the consumer
+    m_stager.reset();
+    if (m_ascent) {
+        m_ascent->close();
+    }
+}
 
 void AscentPostProcess::pre_init_actions() {}
 
@@ -29,6 +61,10 @@ void AscentPostProcess::initialize()
         amrex::ParmParse pp("ascent");
         pp.getarr("fields", field_names);
         pp.query("output_frequency", m_out_freq);
+        pp.query("actions_file", m_actions_file);
+        pp.query("zero_copy", m_zero_copy);
+        pp.query("staging_socket", m_staging_socket);
+        pp.query("staging_buffers", m_staging_buffers);
     }
 
     // Process field information
@@ -42,9 +78,83 @@ void AscentPostProcess::initialize()
         }
 
         auto& fld = repo.get_field(fname);
+        if (m_zero_copy) {
+            const auto floc = fld.field_location();
+            if ((floc != FieldLoc::CELL) && (floc != FieldLoc::NODE)) {
+                amrex::Abort(
+                    "Ascent: zero_copy only supports cell and node fields: " +
+                    fname);
+            }
+            const int ng = fld.num_grow()[0];
+            if (std::find(m_ngrow.begin(), m_ngrow.end(), ng) ==
+                m_ngrow.end()) {
+                m_ngrow.push_back(ng);
+            }
+        }
         m_fields.emplace_back(&fld);
         ioutils::add_var_names(m_var_names, fld.name(), fld.num_comp());
     }
+
+#ifdef AMREX_USE_GPU
+    if (m_zero_copy && !amrex::The_Arena()->isManaged()) {
+        amrex::Abort(
+            "Ascent: zero_copy requires host accessible field data, set "
+            "amrex.the_arena_is_managed=1");
+    }
+#endif
+
+    // Ghost indicator fields of the zero-copy topologies
+    std::vector<std::string> ghost_fields;
+    for (const int ng : m_ngrow) {
+        if (ng > 0) {
+            ghost_fields.push_back(ghost_name(ng));
+        }
+    }
+
+    if (!m_staging_socket.empty()) {
+        // Rendering is performed by the consumer process, the solver only
+        // hands off the Blueprint mesh (and the ghost indicator names that
+        // the consumer must pass to Ascent) and returns
+        m_stager = std::make_unique<BlueprintStager>(
+            m_staging_socket, amrex::ParallelDescriptor::MyProc(),
+            amrex::ParallelDescriptor::NProcs(), m_staging_buffers,
+            ghost_fields);
+        return;
+    }
+
+    load_actions();
+
+    // Open the Ascent runtime once, it is reused for all output steps and
+    // closed when the post-processing instance is destroyed
+    m_ascent = std::make_unique<::ascent::Ascent>();
+    conduit::Node open_opts;
+
+#ifdef BL_USE_MPI
+    open_opts["mpi_comm"] =
+        MPI_Comm_c2f(amrex::ParallelDescriptor::Communicator());
+#endif
+    // Actions are loaded once above and passed explicitly to execute, do not
+    // let Ascent re-read an actions file on every step
+    open_opts["actions_file"] = "";
+    for (const auto& gname : ghost_fields) {
+        open_opts["ghost_field_name"].append() = gname;
+    }
+    m_ascent->open(open_opts);
+}
+
+void AscentPostProcess::load_actions()
+{
+    m_actions = std::make_unique<conduit::Node>();
+    if (m_actions_file.empty()) return;
+
+    amrex::Vector<char> file_chars;
+    amrex::ParallelDescriptor::ReadAndBcastFile(m_actions_file, file_chars);
+    const std::string contents(file_chars.dataPtr());
+
+    const bool is_json =
+        (m_actions_file.size() > 5) &&
+        (m_actions_file.substr(m_actions_file.size() - 5) == ".json");
+    m_actions->parse(contents, is_json ? "json" : "yaml");
 }
 
 void AscentPostProcess::post_advance_work()
@@ -56,6 +166,28 @@ void AscentPostProcess::post_advance_work()
     // Output only on given frequency
     if (!(tidx % m_out_freq == 0)) return;
 
+    amrex::Print() << "Calling Ascent at time " << m_sim.time().new_time()
+                   << std::endl;
+    if (m_zero_copy) {
+        publish_zero_copy();
+    } else {
+        publish_staged();
+    }
+}
+
+void AscentPostProcess::publish(const conduit::Node& bp_mesh)
+{
+    if (m_stager) {
+        m_stager->stage(bp_mesh, m_sim.time().time_index());
+        return;
+    }
+
+    m_ascent->publish(bp_mesh);
+    m_ascent->execute(*m_actions);
+}
+
+void AscentPostProcess::publish_staged()
+{
     amrex::Vector<int> istep(
         m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
 
@@ -81,38 +213,142 @@ void AscentPostProcess::post_advance_work()
 
     const auto& mesh = m_sim.mesh();
 
-    amrex::Print() << "Calling Ascent at time " << m_sim.time().new_time()
-                   << std::endl;
     conduit::Node bp_mesh;
     amrex::MultiLevelToBlueprint(
         nlevels, outfield->vec_const_ptrs(), m_var_names, mesh.Geom(),
         m_sim.time().new_time(), istep, mesh.refRatio(), bp_mesh);
 
-    ascent::Ascent ascent;
-    conduit::Node open_opts;
-
-#ifdef BL_USE_MPI
-    open_opts["mpi_comm"] =
-        MPI_Comm_c2f(amrex::ParallelDescriptor::Communicator());
-#endif
-    ascent.open(open_opts);
     conduit::Node verify_info;
     if (!conduit::blueprint::mesh::verify(bp_mesh, verify_info)) {
         ASCENT_INFO("Error: Mesh Blueprint Verify Failed!");
         verify_info.print();
     }
 
-    conduit::Node actions;
-    ascent.publish(bp_mesh);
+    publish(bp_mesh);
+}
+
+void AscentPostProcess::build_blueprint_mesh()
+{
+    BL_PROFILE("amr-wind::AscentPostProcess::build_blueprint_mesh");
+
+    m_bp_mesh = std::make_unique<conduit::Node>();
+
+    const auto& mesh = m_sim.mesh();
+    const int nlevels = m_sim.repo().num_active_levels();
+
+    int domain_offset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = mesh.Geom(lev);
+        const auto& ba = mesh.boxArray(lev);
+        const auto* problo = geom.ProbLo();
+        const auto* dx = geom.CellSize();
+
+        for (amrex::MFIter mfi(ba, mesh.DistributionMap(lev)); mfi.isValid();
+             ++mfi) {
+            const int domain_id = domain_offset + mfi.index();
+            auto& dom = (*m_bp_mesh)[domain_name(domain_id)];
+            dom["state/domain_id"] = domain_id;
+            dom["state/level"] = lev;
+
+            const auto& vbx = mfi.validbox();
+            for (const int ng : m_ngrow) {
+                const auto gbx = amrex::grow(vbx, ng);
+                const std::string tname = topo_name(ng);
+                const std::string cname = "coords_ng" + std::to_string(ng);
 
-    ascent.execute(actions);
+                auto& coords = dom["coordsets/" + cname];
+                coords["type"] = "uniform";
+                coords["dims/i"] = gbx.length(0) + 1;
+                coords["dims/j"] = gbx.length(1) + 1;
+                coords["dims/k"] = gbx.length(2) + 1;
+                coords["origin/x"] = problo[0] + gbx.smallEnd(0) * dx[0];
+                coords["origin/y"] = problo[1] + gbx.smallEnd(1) * dx[1];
+                coords["origin/z"] = problo[2] + gbx.smallEnd(2) * dx[2];
+                coords["spacing/dx"] = dx[0];
+                coords["spacing/dy"] = dx[1];
+                coords["spacing/dz"] = dx[2];
+
+                auto& topo = dom["topologies/" + tname];
+                topo["type"] = "uniform";
+                topo["coordset"] = cname;
+
+                if (ng < 1) continue;
+
+                // Ghost indicator so that Ascent ignores the FAB ghost cells
+                auto& gfld = dom["fields/" + ghost_name(ng)];
+                gfld["association"] = "element";
+                gfld["topology"] = tname;
+                gfld["values"].set(conduit::DataType::int32(gbx.numPts()));
+                auto* gdata = gfld["values"].as_int32_ptr();
+
+                const auto lo = amrex::lbound(gbx);
+                const auto hi = amrex::ubound(gbx);
+                amrex::Long idx = 0;
+                for (int k = lo.z; k <= hi.z; ++k) {
+                    for (int j = lo.y; j <= hi.y; ++j) {
+                        for (int i = lo.x; i <= hi.x; ++i) {
+                            gdata[idx++] =
+                                vbx.contains(amrex::IntVect(i, j, k)) ? 0 : 1;
+                        }
+                    }
+                }
+            }
+        }
+        domain_offset += ba.size();
+    }
+
+    m_mesh_changed = false;
+}
+
+void AscentPostProcess::publish_zero_copy()
+{
+    BL_PROFILE("amr-wind::AscentPostProcess::publish_zero_copy");
+
+    if (m_mesh_changed) {
+        build_blueprint_mesh();
+    }
+
+    const auto& mesh = m_sim.mesh();
+    const auto& time = m_sim.time();
+    const int nlevels = m_sim.repo().num_active_levels();
+
+    // Field data pointers are refreshed every step as the underlying
+    // MultiFabs can be reallocated between outputs
+    int domain_offset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& ba = mesh.boxArray(lev);
+        for (amrex::MFIter mfi(ba, mesh.DistributionMap(lev)); mfi.isValid();
+             ++mfi) {
+            auto& dom = (*m_bp_mesh)[domain_name(domain_offset + mfi.index())];
+            dom["state/cycle"] = time.time_index();
+            dom["state/time"] = time.new_time();
+
+            int ivar = 0;
+            for (auto* fld : m_fields) {
+                auto& fab = (*fld)(lev)[mfi];
+                const std::string tname = topo_name(fld->num_grow()[0]);
+                const std::string assoc =
+                    (fld->field_location() == FieldLoc::NODE) ? "vertex"
+                                                              : "element";
+                const auto npts = fab.box().numPts();
+                for (int ic = 0; ic < fld->num_comp(); ++ic) {
+                    auto& nfld = dom["fields/" + m_var_names[ivar++]];
+                    nfld["association"] = assoc;
+                    nfld["topology"] = tname;
+                    nfld["values"].set_external(fab.dataPtr(ic), npts);
+                }
+            }
+        }
+        domain_offset += ba.size();
+    }
 
-    ascent.close();
+    publish(*m_bp_mesh);
 }
 
 void AscentPostProcess::post_regrid_actions()
 {
-    // nothing to do here
+    // Blueprint topologies are rebuilt at the next output
+    m_mesh_changed = true;
 }
 
 } // namespace ascent_int
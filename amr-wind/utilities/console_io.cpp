@@ -155,20 +155,28 @@ void print_mlmg_header(const std::string& key)
     amrex::Print() << "  " << std::setw(name_width) << std::left << "System"
                    << std::setw(6) << std::right << "Iters" << std::setw(22)
                    << std::right << "Initial residual" << std::setw(22)
-                   << std::right << "Final residual" << std::endl
+                   << std::right << "Final residual" << std::setw(12)
+                   << std::right << "Setup (s)" << std::setw(12) << std::right
+                   << "Solve (s)" << std::endl
                    << "  "
                       "--------------------------------------------------------"
-                      "--------------------"
+                      "--------------------------------------------"
                    << std::endl;
 }
 
-void print_mlmg_info(const std::string& solve_name, const amrex::MLMG& mlmg)
+void print_mlmg_info(
+    const std::string& solve_name,
+    const amrex::MLMG& mlmg,
+    const amrex::Real setup_time,
+    const amrex::Real solve_time)
 {
     const int name_width = 26;
     amrex::Print() << "  " << std::setw(name_width) << std::left << solve_name
                    << std::setw(6) << std::right << mlmg.getNumIters()
                    << std::setw(22) << std::right << mlmg.getInitResidual()
                    << std::setw(22) << std::right << mlmg.getFinalResidual()
+                   << std::setw(12) << std::right << std::setprecision(4)
+                   << setup_time << std::setw(12) << std::right << solve_time
                    << std::endl;
 }
 
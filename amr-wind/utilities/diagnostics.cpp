@@ -1,43 +1,160 @@
 #include "amr-wind/incflo.H"
+#include "amr-wind/utilities/diagnostics.H"
+
+#include <limits>
 
 using namespace amrex;
 
+namespace amr_wind {
+namespace diagnostics {
+
+namespace {
+
+//! Number of components reduced together in one pass over a MultiFab
+constexpr int ncomp_pass = 3;
+
+using StatsOps = TypeList<
+    ReduceOpMin,
+    ReduceOpMax,
+    ReduceOpMax,
+    ReduceOpMin,
+    ReduceOpMax,
+    ReduceOpMax,
+    ReduceOpMin,
+    ReduceOpMax,
+    ReduceOpMax>;
+using StatsTuple = GpuTuple<Real, Real, int, Real, Real, int, Real, Real, int>;
+
+/** Append the local (-min, max, nan) of up to ncomp_pass components
+ *
+ *  The unused entries of the tuple are filled with neutral values when fewer
+ *  than ncomp_pass components remain.
+ */
+void reduce_components(
+    const amrex::MultiFab& mf,
+    const int scomp,
+    const int ncomp,
+    const bool include_ghosts,
+    amrex::Vector<amrex::Real>& buf)
+{
+    constexpr amrex::Real big = std::numeric_limits<amrex::Real>::max();
+    constexpr amrex::Real lowest = std::numeric_limits<amrex::Real>::lowest();
+
+    const auto& marr = mf.const_arrays();
+    auto res = amrex::ParReduce(
+        StatsOps{},
+        TypeList<Real, Real, int, Real, Real, int, Real, Real, int>{}, mf,
+        include_ghosts ? mf.nGrowVect() : IntVect(0),
+        [=] AMREX_GPU_HOST_DEVICE(
+            int box_no, int i, int j, int k) -> StatsTuple {
+            amrex::Real vmin[ncomp_pass] = {big, big, big};
+            amrex::Real vmax[ncomp_pass] = {lowest, lowest, lowest};
+            int vnan[ncomp_pass] = {0, 0, 0};
+            for (int m = 0; m < ncomp; ++m) {
+                const amrex::Real val = marr[box_no](i, j, k, scomp + m);
+                if (amrex::isnan(val)) {
+                    vnan[m] = 1;
+                } else {
+                    vmin[m] = val;
+                    vmax[m] = val;
+                }
+            }
+            return {vmin[0], vmax[0], vnan[0], vmin[1], vmax[1],
+                    vnan[1], vmin[2], vmax[2], vnan[2]};
+        });
+
+    const amrex::Real rmin[ncomp_pass] = {
+        amrex::get<0>(res), amrex::get<3>(res), amrex::get<6>(res)};
+    const amrex::Real rmax[ncomp_pass] = {
+        amrex::get<1>(res), amrex::get<4>(res), amrex::get<7>(res)};
+    const int rnan[ncomp_pass] = {
+        amrex::get<2>(res), amrex::get<5>(res), amrex::get<8>(res)};
+    for (int m = 0; m < ncomp; ++m) {
+        buf.push_back(-rmin[m]);
+        buf.push_back(rmax[m]);
+        buf.push_back(static_cast<amrex::Real>(rnan[m]));
+    }
+}
+
+} // namespace
+
+amrex::Vector<MultiFabStats>
+compute_stats(
+    const amrex::Vector<const amrex::MultiFab*>& mfs, const bool include_ghosts)
+{
+    BL_PROFILE("amr-wind::diagnostics::compute_stats");
+
+    // Local results packed as (-min, max, nan) so that a single max reduction
+    // combines all of them
+    amrex::Vector<amrex::Real> buf;
+    for (const auto* mf : mfs) {
+        for (int n = 0; n < mf->nComp(); n += ncomp_pass) {
+            reduce_components(
+                *mf, n, amrex::min(ncomp_pass, mf->nComp() - n),
+                include_ghosts, buf);
+        }
+    }
+
+    amrex::ParallelAllReduce::Max<amrex::Real>(
+        buf.data(), static_cast<int>(buf.size()),
+        amrex::ParallelContext::CommunicatorSub());
+
+    amrex::Vector<MultiFabStats> stats(mfs.size());
+    int idx = 0;
+    for (int i = 0; i < static_cast<int>(mfs.size()); ++i) {
+        const int ncomp = mfs[i]->nComp();
+        auto& st = stats[i];
+        st.min.resize(ncomp);
+        st.max.resize(ncomp);
+        st.has_nan.resize(ncomp);
+        for (int n = 0; n < ncomp; ++n) {
+            st.min[n] = -buf[idx++];
+            st.max[n] = buf[idx++];
+            st.has_nan[n] = static_cast<int>(buf[idx++] > 0.0);
+        }
+    }
+    return stats;
+}
+
+} // namespace diagnostics
+} // namespace amr_wind
+
 //
 // Print maximum values (useful for tracking evolution)
 //
-void incflo::PrintMaxValues(const std::string& header)
+void incflo::PrintMaxValues(
+    const std::string& header, amr_wind::FieldState fstate)
 {
     BL_PROFILE("amr-wind::incflo::PrintMaxValues");
 
+    amrex::Vector<amr_wind::Field*> fields{
+        &icns().fields().field.state(fstate), &grad_p()};
+    for (auto& eqn : scalar_eqns()) {
+        fields.push_back(&eqn->fields().field.state(fstate));
+    }
+
+    amrex::Vector<const amrex::MultiFab*> mfs;
+    for (int lev = 0; lev <= finest_level; lev++) {
+        for (const auto* fld : fields) {
+            mfs.push_back(&(*fld)(lev));
+        }
+    }
+    const auto stats = amr_wind::diagnostics::compute_stats(mfs);
+
     amrex::Print() << "\nL-inf norm summary: " << header << std::endl
                    << "........................................................"
                       "......................";
 
+    int idx = 0;
     for (int lev = 0; lev <= finest_level; lev++) {
         amrex::Print() << "\nLevel " << lev << std::endl;
 
-        auto& vel = icns().fields().field;
-        amrex::Print() << "  " << std::setw(16) << std::left << vel.name();
-        for (int i = 0; i < vel.num_comp(); ++i) {
-            amrex::Print() << std::setw(20) << std::right << vel(lev).norm0(i);
-        }
-        amrex::Print() << std::endl;
-
-        auto& gradp = grad_p();
-        amrex::Print() << "  " << std::setw(16) << std::left << gradp.name();
-        for (int i = 0; i < gradp.num_comp(); ++i) {
-            amrex::Print() << std::setw(20) << std::right
-                           << gradp(lev).norm0(i);
-        }
-        amrex::Print() << std::endl;
-
-        for (auto& eqn : scalar_eqns()) {
-            auto& field = eqn->fields().field;
+        for (const auto* fld : fields) {
+            const auto& st = stats[idx++];
             amrex::Print() << "  " << std::setw(16) << std::left
-                           << field.name();
-            for (int i = 0; i < field.num_comp(); ++i) {
-                amrex::Print()
-                    << std::setw(20) << std::right << field(lev).norm0(i);
+                           << fld->base_name();
+            for (int i = 0; i < fld->num_comp(); ++i) {
+                amrex::Print() << std::setw(20) << std::right << st.norm0(i);
             }
             amrex::Print() << std::endl;
         }
@@ -74,29 +191,29 @@ void incflo::PrintMaxGp(int lev) const
 void incflo::CheckForNans(int lev) const
 {
     BL_PROFILE("amr-wind::incflo::CheckForNans");
-    bool ro_has_nans = density()(lev).contains_nan(false);
-    bool ug_has_nans = velocity()(lev).contains_nan(false);
-    bool vg_has_nans = velocity()(lev).contains_nan(true);
-    bool wg_has_nans = velocity()(lev).contains_nan(true);
-    bool pg_has_nans = pressure()(lev).contains_nan(false);
+    const auto stats = amr_wind::diagnostics::compute_stats(
+        {&density()(lev), &velocity()(lev), &pressure()(lev)}, true);
+    const auto& ro_stats = stats[0];
+    const auto& vel_stats = stats[1];
+    const auto& p_stats = stats[2];
 
-    if (ro_has_nans) {
+    if (ro_stats.any_nan()) {
         amrex::Print() << "WARNING: ro contains NaNs!!!";
     }
 
-    if (ug_has_nans) {
+    if (vel_stats.has_nan[0] != 0) {
         amrex::Print() << "WARNING: u contains NaNs!!!";
     }
 
-    if (vg_has_nans) {
+    if (vel_stats.has_nan[1] != 0) {
         amrex::Print() << "WARNING: v contains NaNs!!!";
     }
 
-    if (wg_has_nans) {
+    if (vel_stats.has_nan[2] != 0) {
         amrex::Print() << "WARNING: w contains NaNs!!!";
     }
 
-    if (pg_has_nans) {
+    if (p_stats.any_nan()) {
         amrex::Print() << "WARNING: p contains NaNs!!!";
     }
 }
@@ -1,6 +1,9 @@
 #include "amr-wind/utilities/sampling/FreeSurface.H"
 #include "amr-wind/utilities/io_utils.H"
 #include <AMReX_MultiFabUtil.H>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
@@ -9,14 +12,226 @@
 namespace amr_wind {
 namespace free_surface {
 
-FreeSurface::FreeSurface(CFDSim& sim, std::string label)
-    : m_sim(sim), m_label(std::move(label)), m_vof(sim.repo().get_field("vof"))
+namespace {
+
+//! Marker for a 2D grid point that does not lie within a box
+constexpr int invalid_cell = std::numeric_limits<int>::lowest();
+
+/** Range of 2D grid indices along one direction that can lie in [xlo, xhi]
+ *
+ *  The range is padded by one point on either side; the exact test is
+ *  performed by find_cell. An empty range has second < first.
+ */
+std::pair<int, int> sample_range(
+    const amrex::Real start,
+    const amrex::Real sdx,
+    const int npts,
+    const amrex::Real xlo,
+    const amrex::Real xhi)
 {
-#ifdef AMREX_USE_GPU
-    amrex::Print() << "WARNING: FreeSurface: Running on GPUs..." << std::endl;
-#endif
+    if ((npts < 2) || (sdx == 0.0)) {
+        return {0, npts - 1};
+    }
+    const amrex::Real sa = (xlo - start) / sdx;
+    const amrex::Real sb = (xhi - start) / sdx;
+    const amrex::Real slo = amrex::min(sa, sb);
+    const amrex::Real shi = amrex::max(sa, sb);
+    return {
+        amrex::max(static_cast<int>(std::floor(slo)) - 1, 0),
+        amrex::min(static_cast<int>(std::ceil(shi)) + 1, npts - 1)};
+}
+
+/** Index of the cell within [lo, hi] that contains the grid coordinate
+ *
+ *  The conditional avoids double-counting points on cell faces and includes
+ *  an exception for the lo boundary. Returns invalid_cell if the coordinate
+ *  is outside the index range.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE int find_cell(
+    const amrex::Real loc,
+    const amrex::Real plo,
+    const amrex::Real dx,
+    const amrex::Real dxi,
+    const int lo,
+    const int hi) noexcept
+{
+    const int c0 = static_cast<int>(amrex::Math::floor((loc - plo) * dxi));
+    for (int c = amrex::max(c0 - 1, lo); c <= amrex::min(c0 + 1, hi); ++c) {
+        const amrex::Real xm = plo + (c + 0.5) * dx;
+        if ((plo == loc && xm - loc == 0.5 * dx) ||
+            (xm - loc < 0.5 * dx && loc - xm <= 0.5 * dx)) {
+            return c;
+        }
+    }
+    return invalid_cell;
+}
+
+/** Location of the vof = 0.5 isosurface along the search direction
+ *
+ *  Returns plo[dir] if the cell is not multiphase or the isosurface cannot
+ *  be detected in the search direction.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real interface_height(
+    const amrex::IntVect& iv,
+    amrex::Array4<amrex::Real const> const& vof_arr,
+    const amrex::GpuArray<amrex::Real, 2>& loc,
+    const int dir,
+    const int gc1,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dxi,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& plo) noexcept
+{
+    const int i = iv[0];
+    const int j = iv[1];
+    const int k = iv[2];
+    // Initialize height measurement
+    amrex::Real ht = plo[dir];
+    // Cell location
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
+    xm[0] = plo[0] + (i + 0.5) * dx[0];
+    xm[1] = plo[1] + (j + 0.5) * dx[1];
+    xm[2] = plo[2] + (k + 0.5) * dx[2];
+    int ip = static_cast<int>(dir == 0);
+    const int im = i - ip;
+    ip = i + ip;
+    int jp = static_cast<int>(dir == 1);
+    const int jm = j - jp;
+    jp = j + jp;
+    int kp = static_cast<int>(dir == 2);
+    const int km = k - kp;
+    kp = k + kp;
+    // Check if cell is obviously multiphase, then check if cell might have
+    // interface at top or bottom
+    if (!((vof_arr(i, j, k) < (1.0 - 1e-12) && vof_arr(i, j, k) > 1e-12) ||
+          (vof_arr(i, j, k) < 1e-12 &&
+           (vof_arr(ip, jp, kp) > (1.0 - 1e-12) ||
+            vof_arr(im, jm, km) > (1.0 - 1e-12))))) {
+        return ht;
+    }
+
+    // Interpolate in x and y for the current cell and the ones above and
+    // below
+    amrex::Real wx_hi = 0.0;
+    amrex::Real wy_hi = 0.0;
+    amrex::Real wz_hi = 0.0;
+    int iup = i;
+    int idn = i;
+    int jup = j;
+    int jdn = j;
+    int kup = k;
+    int kdn = k;
+
+    // Determine which cells to use for grid
+    if (dir != 0) {
+        // If x is a grid coord, it is always first (e.g., xy or xz)
+        int li = 0;
+        if (loc[li] < xm[0]) {
+            iup = i;
+            idn = i - 1;
+            wx_hi = (loc[li] - (xm[0] - dx[0])) * dxi[0];
+        } else {
+            iup = i + 1;
+            idn = i;
+            wx_hi = (loc[li] - xm[0]) * dxi[0];
+        }
+    }
+    if (dir != 1) {
+        // y can be first or second (xy, yz)
+        int li = (gc1 == 1 ? 0 : 1);
+        if (loc[li] < xm[1]) {
+            jup = j;
+            jdn = j - 1;
+            wy_hi = (loc[li] - (xm[1] - dx[1])) * dxi[1];
+        } else {
+            jup = j + 1;
+            jdn = j;
+            wy_hi = (loc[li] - xm[1]) * dxi[1];
+        }
+    }
+    if (dir != 2) {
+        // If z is a grid coord, it is always second (e.g., yz or xz)
+        int li = 1;
+        if (loc[li] < xm[2]) {
+            kup = k;
+            kdn = k - 1;
+            wz_hi = (loc[li] - (xm[2] - dx[2])) * dxi[2];
+        } else {
+            kup = k + 1;
+            kdn = k;
+            wz_hi = (loc[li] - xm[2]) * dxi[2];
+        }
+    }
+    const amrex::Real wx_lo = 1.0 - wx_hi;
+    const amrex::Real wy_lo = 1.0 - wy_hi;
+    const amrex::Real wz_lo = 1.0 - wz_hi;
+
+    amrex::Real vof_above = 0.0;
+    amrex::Real vof_below = 0.0;
+    amrex::Real vof_here = 0.0;
+
+    if (dir == 0) {
+        vof_above = wz_lo * wy_lo * vof_arr(i + 1, jdn, kdn) +
+                    wz_lo * wy_hi * vof_arr(i + 1, jup, kdn) +
+                    wz_hi * wy_lo * vof_arr(i + 1, jdn, kup) +
+                    wz_hi * wy_hi * vof_arr(i + 1, jup, kup);
+        vof_here = wz_lo * wy_lo * vof_arr(i, jdn, kdn) +
+                   wz_lo * wy_hi * vof_arr(i, jup, kdn) +
+                   wz_hi * wy_lo * vof_arr(i, jdn, kup) +
+                   wz_hi * wy_hi * vof_arr(i, jup, kup);
+        vof_below = wz_lo * wy_lo * vof_arr(i - 1, jdn, kdn) +
+                    wz_lo * wy_hi * vof_arr(i - 1, jup, kdn) +
+                    wz_hi * wy_lo * vof_arr(i - 1, jdn, kup) +
+                    wz_hi * wy_hi * vof_arr(i - 1, jup, kup);
+    }
+    if (dir == 1) {
+        vof_above = wx_lo * wz_lo * vof_arr(idn, j + 1, kdn) +
+                    wx_lo * wz_hi * vof_arr(idn, j + 1, kup) +
+                    wx_hi * wz_lo * vof_arr(iup, j + 1, kdn) +
+                    wx_hi * wz_hi * vof_arr(iup, j + 1, kup);
+        vof_here = wx_lo * wz_lo * vof_arr(idn, j, kdn) +
+                   wx_lo * wz_hi * vof_arr(idn, j, kup) +
+                   wx_hi * wz_lo * vof_arr(iup, j, kdn) +
+                   wx_hi * wz_hi * vof_arr(iup, j, kup);
+        vof_below = wx_lo * wz_lo * vof_arr(idn, j - 1, kdn) +
+                    wx_lo * wz_hi * vof_arr(idn, j - 1, kup) +
+                    wx_hi * wz_lo * vof_arr(iup, j - 1, kdn) +
+                    wx_hi * wz_hi * vof_arr(iup, j - 1, kup);
+    }
+    if (dir == 2) {
+        vof_above = wx_lo * wy_lo * vof_arr(idn, jdn, k + 1) +
+                    wx_lo * wy_hi * vof_arr(idn, jup, k + 1) +
+                    wx_hi * wy_lo * vof_arr(iup, jdn, k + 1) +
+                    wx_hi * wy_hi * vof_arr(iup, jup, k + 1);
+        vof_here = wx_lo * wy_lo * vof_arr(idn, jdn, k) +
+                   wx_lo * wy_hi * vof_arr(idn, jup, k) +
+                   wx_hi * wy_lo * vof_arr(iup, jdn, k) +
+                   wx_hi * wy_hi * vof_arr(iup, jup, k);
+        vof_below = wx_lo * wy_lo * vof_arr(idn, jdn, k - 1) +
+                    wx_lo * wy_hi * vof_arr(idn, jup, k - 1) +
+                    wx_hi * wy_lo * vof_arr(iup, jdn, k - 1) +
+                    wx_hi * wy_hi * vof_arr(iup, jup, k - 1);
+    }
+    // Determine which cell to interpolate with
+    const bool above = (vof_above - 0.5) * (vof_here - 0.5) <= 0.0;
+    const bool below = (vof_below - 0.5) * (vof_here - 0.5) <= 0.0;
+    if (above) {
+        // Interpolate positive direction
+        ht = xm[dir] + (dx[dir]) / (vof_above - vof_here) * (0.5 - vof_here);
+    } else if (below) {
+        // Interpolate negative direction
+        ht = xm[dir] - (dx[dir]) / (vof_below - vof_here) * (0.5 - vof_here);
+    }
+    // If none satisfy requirement, then the isosurface vof = 0.5 cannot be
+    // detected in the search direction
+    return ht;
 }
 
+} // namespace
+
+FreeSurface::FreeSurface(CFDSim& sim, std::string label)
+    : m_sim(sim), m_label(std::move(label)), m_vof(sim.repo().get_field("vof"))
+{}
+
 FreeSurface::~FreeSurface() = default;
 
 void FreeSurface::initialize()
@@ -70,7 +285,7 @@ void FreeSurface::initialize()
     m_out.resize(m_npts * m_ninst);
 
     // Get size of sample grid spacing
-    amrex::Vector<amrex::Real> dx = {0.0, 0.0};
+    auto& dx = m_dxs;
     dx[0] = (m_end[m_gc1] - m_start[m_gc1]) / amrex::max(m_npts_dir[0] - 1, 1);
     dx[1] = (m_end[m_gc2] - m_start[m_gc2]) / amrex::max(m_npts_dir[1] - 1, 1);
 
@@ -107,37 +322,36 @@ void FreeSurface::post_advance_work()
         return;
     }
 
-    // Zero data in output array
-    for (int n = 0; n < m_npts * m_ninst; n++) {
-        m_out[n] = 0.0;
-    }
     // Set up device vector of outputs, initialize to above phi0
     const auto& plo0 = m_sim.mesh().Geom(0).ProbLoArray();
     const auto& phi0 = m_sim.mesh().Geom(0).ProbHiArray();
     amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, phi0[2] + 1.0);
-    auto* dout_ptr = dout.data();
+    const auto* dout_ptr = dout.data();
+    // Per-point heights relative to problo, accumulated over boxes and levels
+    amrex::Gpu::DeviceVector<amrex::Real> dheight(m_npts);
+    auto* dheight_ptr = dheight.data();
 
-    // Sum of interface locations at each point (assumes one interface only)
     const int finest_level = m_vof.repo().num_active_levels() - 1;
 
+    const int dir = m_coorddir;
+    const int gc1 = m_gc1;
+    const int gc2 = m_gc2;
+    const int np1 = m_npts_dir[0];
+    const amrex::GpuArray<amrex::Real, 2> start{
+        m_start[m_gc1], m_start[m_gc2]};
+    const amrex::GpuArray<amrex::Real, 2> sdx{m_dxs[0], m_dxs[1]};
+
     // Loop instances
     for (int ni = 0; ni < m_ninst; ++ni) {
-        for (int lev = 0; lev <= finest_level; lev++) {
+        auto* out_ptr = &m_out[ni * m_npts];
+        std::fill(out_ptr, out_ptr + m_npts, 0.0);
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, out_ptr, out_ptr + m_npts,
+            dheight.begin());
 
+        for (int lev = 0; lev <= finest_level; lev++) {
             // Use level_mask to identify smallest volume
-            amrex::iMultiFab level_mask;
-            if (lev < finest_level) {
-                level_mask = makeFineMask(
-                    m_sim.mesh().boxArray(lev),
-                    m_sim.mesh().DistributionMap(lev),
-                    m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-            } else {
-                level_mask.define(
-                    m_sim.mesh().boxArray(lev),
-                    m_sim.mesh().DistributionMap(lev), 1, 0, amrex::MFInfo());
-                level_mask.setVal(1);
-            }
-
+            const auto& level_mask = m_vof.repo().level_mask(lev);
             const auto& vof = m_vof(lev);
             const auto& geom = m_sim.mesh().Geom(lev);
             const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
@@ -147,299 +361,87 @@ void FreeSurface::post_advance_work()
             const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
                 geom.ProbLoArray();
 
-            const int captured_m_coorddir = m_coorddir;
-            const int captured_m_gc1 = m_gc1;
-            const int captured_m_gc2 = m_gc2;
-
-            // Loop points in 2D grid
-            for (int n = 0; n < m_npts; ++n) {
-                amrex::GpuArray<amrex::Real, 2> loc;
-                for (int d = 0; d < 2; ++d) {
-                    loc[d] = m_locs[n][d];
+            for (amrex::MFIter mfi(vof); mfi.isValid(); ++mfi) {
+                const auto& bx = mfi.validbox();
+                // Points of the 2D grid that can lie within the box
+                const auto r1 = sample_range(
+                    start[0], sdx[0], np1,
+                    plo[gc1] + bx.smallEnd(gc1) * dx[gc1],
+                    plo[gc1] + (bx.bigEnd(gc1) + 1) * dx[gc1]);
+                const auto r2 = sample_range(
+                    start[1], sdx[1], m_npts_dir[1],
+                    plo[gc2] + bx.smallEnd(gc2) * dx[gc2],
+                    plo[gc2] + (bx.bigEnd(gc2) + 1) * dx[gc2]);
+                if ((r1.second < r1.first) || (r2.second < r2.first)) {
+                    continue;
                 }
-
-                m_out[ni * m_npts + n] = amrex::max(
-                    m_out[ni * m_npts + n],
-                    amrex::ReduceMax(
-                        vof, level_mask, 0,
-                        [=] AMREX_GPU_HOST_DEVICE(
-                            amrex::Box const& bx,
-                            amrex::Array4<amrex::Real const> const& vof_arr,
-                            amrex::Array4<int const> const& mask_arr)
-                            -> amrex::Real {
-                            amrex::Real height_fab = 0.0;
-
-                            amrex::Loop(
-                                bx,
-                                [=, &height_fab](int i, int j, int k) noexcept {
-                                    // Initialize height measurement
-                                    amrex::Real ht = plo[captured_m_coorddir];
-                                    // Cell location
-                                    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>
-                                        xm;
-                                    xm[0] = plo[0] + (i + 0.5) * dx[0];
-                                    xm[1] = plo[1] + (j + 0.5) * dx[1];
-                                    xm[2] = plo[2] + (k + 0.5) * dx[2];
-                                    int ip = static_cast<int>(
-                                        captured_m_coorddir == 0);
-                                    const int im = i - ip;
-                                    ip = i + ip;
-                                    int jp = static_cast<int>(
-                                        captured_m_coorddir == 1);
-                                    const int jm = j - jp;
-                                    jp = j + jp;
-                                    int kp = static_cast<int>(
-                                        captured_m_coorddir == 2);
-                                    const int km = k - kp;
-                                    kp = k + kp;
-                                    // (1) Check that cell height is below
-                                    // previous instance. (2) Check if cell
-                                    // contains 2D grid point: complicated
-                                    // conditional is to avoid double-counting
-                                    // and includes exception for lo boundary.
-                                    // (3) Check if cell is obviously
-                                    // multiphase, then check if cell might have
-                                    // interface at top or bottom
-                                    if ((dout_ptr[n] >
-                                         xm[captured_m_coorddir] +
-                                             0.5 * dx[captured_m_coorddir]) &&
-                                        (((plo[captured_m_gc1] == loc[0] &&
-                                           xm[captured_m_gc1] - loc[0] ==
-                                               0.5 * dx[captured_m_gc1]) ||
-                                          (xm[captured_m_gc1] - loc[0] <
-                                               0.5 * dx[captured_m_gc1] &&
-                                           loc[0] - xm[captured_m_gc1] <=
-                                               0.5 * dx[captured_m_gc1])) &&
-                                         ((plo[captured_m_gc2] == loc[1] &&
-                                           xm[captured_m_gc2] - loc[1] ==
-                                               0.5 * dx[captured_m_gc2]) ||
-                                          (xm[captured_m_gc2] - loc[1] <
-                                               0.5 * dx[captured_m_gc2] &&
-                                           loc[1] - xm[captured_m_gc2] <=
-                                               0.5 * dx[captured_m_gc2]))) &&
-                                        ((vof_arr(i, j, k) < (1.0 - 1e-12) &&
-                                          vof_arr(i, j, k) > 1e-12) ||
-                                         (vof_arr(i, j, k) < 1e-12 &&
-                                          (vof_arr(ip, jp, kp) >
-                                               (1.0 - 1e-12) ||
-                                           vof_arr(im, jm, km) >
-                                               (1.0 - 1e-12))))) {
-                                        // Interpolate in x and y for the
-                                        // current cell and the ones above and
-                                        // below
-                                        amrex::Real wx_hi = 0.0;
-                                        amrex::Real wy_hi = 0.0;
-                                        amrex::Real wz_hi = 0.0;
-                                        int iup = i;
-                                        int idn = i;
-                                        int jup = j;
-                                        int jdn = j;
-                                        int kup = k;
-                                        int kdn = k;
-
-                                        // Determine which cells to use for grid
-                                        if (captured_m_coorddir != 0) {
-                                            // If x is a grid coord, it is
-                                            // always first (e.g., xy or xz)
-                                            int li = 0;
-                                            if (loc[li] < xm[0]) {
-                                                iup = i;
-                                                idn = i - 1;
-                                                wx_hi = (loc[li] -
-                                                         (xm[0] - dx[0])) *
-                                                        dxi[0];
-                                            } else {
-                                                iup = i + 1;
-                                                idn = i;
-                                                wx_hi =
-                                                    (loc[li] - xm[0]) * dxi[0];
-                                            }
-                                        }
-                                        if (captured_m_coorddir != 1) {
-                                            // y can be first or second (xy, yz)
-                                            int li =
-                                                (captured_m_gc1 == 1 ? 0 : 1);
-                                            if (loc[li] < xm[1]) {
-                                                jup = j;
-                                                jdn = j - 1;
-                                                wy_hi = (loc[li] -
-                                                         (xm[1] - dx[1])) *
-                                                        dxi[1];
-                                            } else {
-                                                jup = j + 1;
-                                                jdn = j;
-                                                wy_hi =
-                                                    (loc[li] - xm[1]) * dxi[1];
-                                            }
-                                        }
-                                        if (captured_m_coorddir != 2) {
-                                            // If z is a grid coord, it is
-                                            // always second (e.g., yz or xz)
-                                            int li = 1;
-                                            if (loc[li] < xm[2]) {
-                                                kup = k;
-                                                kdn = k - 1;
-                                                wz_hi = (loc[li] -
-                                                         (xm[2] - dx[2])) *
-                                                        dxi[2];
-                                            } else {
-                                                kup = k + 1;
-                                                kdn = k;
-                                                wz_hi =
-                                                    (loc[li] - xm[2]) * dxi[2];
-                                            }
-                                        }
-                                        const amrex::Real wx_lo = 1.0 - wx_hi;
-                                        const amrex::Real wy_lo = 1.0 - wy_hi;
-                                        const amrex::Real wz_lo = 1.0 - wz_hi;
-
-                                        amrex::Real vof_above = 0.0;
-                                        amrex::Real vof_below = 0.0;
-                                        amrex::Real vof_here = 0.0;
-
-                                        if (captured_m_coorddir == 0) {
-                                            vof_above =
-                                                wz_lo * wy_lo *
-                                                    vof_arr(i + 1, jdn, kdn) +
-                                                wz_lo * wy_hi *
-                                                    vof_arr(i + 1, jup, kdn) +
-                                                wz_hi * wy_lo *
-                                                    vof_arr(i + 1, jdn, kup) +
-                                                wz_hi * wy_hi *
-                                                    vof_arr(i + 1, jup, kup);
-                                            vof_here =
-                                                wz_lo * wy_lo *
-                                                    vof_arr(i, jdn, kdn) +
-                                                wz_lo * wy_hi *
-                                                    vof_arr(i, jup, kdn) +
-                                                wz_hi * wy_lo *
-                                                    vof_arr(i, jdn, kup) +
-                                                wz_hi * wy_hi *
-                                                    vof_arr(i, jup, kup);
-                                            vof_below =
-                                                wz_lo * wy_lo *
-                                                    vof_arr(i - 1, jdn, kdn) +
-                                                wz_lo * wy_hi *
-                                                    vof_arr(i - 1, jup, kdn) +
-                                                wz_hi * wy_lo *
-                                                    vof_arr(i - 1, jdn, kup) +
-                                                wz_hi * wy_hi *
-                                                    vof_arr(i - 1, jup, kup);
-                                        }
-                                        if (captured_m_coorddir == 1) {
-                                            vof_above =
-                                                wx_lo * wz_lo *
-                                                    vof_arr(idn, j + 1, kdn) +
-                                                wx_lo * wz_hi *
-                                                    vof_arr(idn, j + 1, kup) +
-                                                wx_hi * wz_lo *
-                                                    vof_arr(iup, j + 1, kdn) +
-                                                wx_hi * wz_hi *
-                                                    vof_arr(iup, j + 1, kup);
-                                            vof_here =
-                                                wx_lo * wz_lo *
-                                                    vof_arr(idn, j, kdn) +
-                                                wx_lo * wz_hi *
-                                                    vof_arr(idn, j, kup) +
-                                                wx_hi * wz_lo *
-                                                    vof_arr(iup, j, kdn) +
-                                                wx_hi * wz_hi *
-                                                    vof_arr(iup, j, kup);
-                                            vof_below =
-                                                wx_lo * wz_lo *
-                                                    vof_arr(idn, j - 1, kdn) +
-                                                wx_lo * wz_hi *
-                                                    vof_arr(idn, j - 1, kup) +
-                                                wx_hi * wz_lo *
-                                                    vof_arr(iup, j - 1, kdn) +
-                                                wx_hi * wz_hi *
-                                                    vof_arr(iup, j - 1, kup);
-                                        }
-                                        if (captured_m_coorddir == 2) {
-                                            vof_above =
-                                                wx_lo * wy_lo *
-                                                    vof_arr(idn, jdn, k + 1) +
-                                                wx_lo * wy_hi *
-                                                    vof_arr(idn, jup, k + 1) +
-                                                wx_hi * wy_lo *
-                                                    vof_arr(iup, jdn, k + 1) +
-                                                wx_hi * wy_hi *
-                                                    vof_arr(iup, jup, k + 1);
-                                            vof_here =
-                                                wx_lo * wy_lo *
-                                                    vof_arr(idn, jdn, k) +
-                                                wx_lo * wy_hi *
-                                                    vof_arr(idn, jup, k) +
-                                                wx_hi * wy_lo *
-                                                    vof_arr(iup, jdn, k) +
-                                                wx_hi * wy_hi *
-                                                    vof_arr(iup, jup, k);
-                                            vof_below =
-                                                wx_lo * wy_lo *
-                                                    vof_arr(idn, jdn, k - 1) +
-                                                wx_lo * wy_hi *
-                                                    vof_arr(idn, jup, k - 1) +
-                                                wx_hi * wy_lo *
-                                                    vof_arr(iup, jdn, k - 1) +
-                                                wx_hi * wy_hi *
-                                                    vof_arr(iup, jup, k - 1);
-                                        }
-                                        // Determine which cell to
-                                        // interpolate with
-                                        const bool above =
-                                            (vof_above - 0.5) *
-                                                (vof_here - 0.5) <=
-                                            0.0;
-                                        const bool below =
-                                            (vof_below - 0.5) *
-                                                (vof_here - 0.5) <=
-                                            0.0;
-                                        if (above) {
-                                            // Interpolate positive
-                                            // direction
-                                            ht = xm[captured_m_coorddir] +
-                                                 (dx[captured_m_coorddir]) /
-                                                     (vof_above - vof_here) *
-                                                     (0.5 - vof_here);
-                                        } else {
-                                            if (below) {
-                                                // Interpolate negative
-                                                // direction
-                                                ht =
-                                                    xm[captured_m_coorddir] -
-                                                    (dx[captured_m_coorddir]) /
-                                                        (vof_below - vof_here) *
-                                                        (0.5 - vof_here);
-                                            }
-                                            // If none satisfy requirement, then
-                                            // the isosurface vof = 0.5 cannot
-                                            // be detected in the z-direction
-                                        }
-                                    }
-                                    // Offset by removing lo and contribute to
-                                    // whole
-                                    height_fab = amrex::max(
-                                        height_fab,
-                                        mask_arr(i, j, k) *
-                                            (ht - plo[captured_m_coorddir]));
-                                });
-                            return height_fab;
-                        }));
+                const amrex::Box pbx(
+                    amrex::IntVect(r1.first, r2.first, 0),
+                    amrex::IntVect(r1.second, r2.second, 0));
+
+                const auto& vof_arr = vof.const_array(mfi);
+                const auto& mask_arr = level_mask.const_array(mfi);
+                const int lo1 = bx.smallEnd(gc1);
+                const int hi1 = bx.bigEnd(gc1);
+                const int lo2 = bx.smallEnd(gc2);
+                const int hi2 = bx.bigEnd(gc2);
+                const int lod = bx.smallEnd(dir);
+                const int hid = bx.bigEnd(dir);
+                amrex::ParallelFor(
+                    pbx, [=] AMREX_GPU_DEVICE(int p1, int p2, int) noexcept {
+                        const int n = p2 * np1 + p1;
+                        const amrex::GpuArray<amrex::Real, 2> loc{
+                            start[0] + sdx[0] * p1, start[1] + sdx[1] * p2};
+
+                        // Column of this box containing the 2D grid point
+                        const int c1 = find_cell(
+                            loc[0], plo[gc1], dx[gc1], dxi[gc1], lo1, hi1);
+                        const int c2 = find_cell(
+                            loc[1], plo[gc2], dx[gc2], dxi[gc2], lo2, hi2);
+                        if ((c1 == invalid_cell) || (c2 == invalid_cell)) {
+                            return;
+                        }
+
+                        amrex::Real height_col = 0.0;
+                        amrex::IntVect iv;
+                        iv[gc1] = c1;
+                        iv[gc2] = c2;
+                        for (int c = lod; c <= hid; ++c) {
+                            iv[dir] = c;
+                            // Skip cells covered by a finer level and check
+                            // that cell height is below previous instance
+                            if ((mask_arr(iv) == 0) ||
+                                !(dout_ptr[n] >
+                                  plo[dir] + (c + 0.5) * dx[dir] +
+                                      0.5 * dx[dir])) {
+                                continue;
+                            }
+                            const amrex::Real ht = interface_height(
+                                iv, vof_arr, loc, dir, gc1, dx, dxi, plo);
+                            height_col =
+                                amrex::max(height_col, ht - plo[dir]);
+                        }
+                        if (height_col > 0.0) {
+                            amrex::Gpu::Atomic::Max(
+                                &dheight_ptr[n], height_col);
+                        }
+                    });
             }
         }
 
-        // Loop points in 2D grid
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
-        }
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, dheight.begin(), dheight.end(),
+            out_ptr);
+        // One reduction for all points of this instance
+        amrex::ParallelDescriptor::ReduceRealMax(out_ptr, m_npts);
         // Add problo back to heights, making them absolute, not relative
         for (int n = 0; n < m_npts; n++) {
-            m_out[ni * m_npts + n] += plo0[m_coorddir];
+            out_ptr[n] += plo0[m_coorddir];
         }
         // Copy last m_out to device vector
         amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &m_out[ni * m_npts],
-            &m_out[(ni + 1) * m_npts - 1] + 1, dout.begin());
+            amrex::Gpu::hostToDevice, out_ptr, out_ptr + m_npts,
+            dout.begin());
     }
 
     process_output();
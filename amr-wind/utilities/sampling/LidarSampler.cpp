@@ -100,15 +100,15 @@ void LidarSampler::define_netcdf_metadata(const ncutils::NCGroup& grp) const
 
 void LidarSampler::populate_netcdf_metadata(const ncutils::NCGroup&) const {}
 void LidarSampler::output_netcdf_data(
-    const ncutils::NCGroup& grp, const size_t nt) const
+    const ncutils::NCGroup& grp,
+    const size_t nt,
+    const SamplerBase::SampleLocType& locs) const
 {
     // Write the coordinates every time
     std::vector<size_t> start{nt, 0, 0};
     std::vector<size_t> count{1, 0, AMREX_SPACEDIM};
-    SamplerBase::SampleLocType locs;
-    sampling_locations(locs);
     auto xyz = grp.var("points");
-    count[1] = num_points();
+    count[1] = locs.size();
     xyz.put(&locs[0][0], start, count);
 }
 #else
@@ -119,7 +119,9 @@ void LidarSampler::populate_netcdf_metadata(
     const ncutils::NCGroup& /*unused*/) const
 {}
 void LidarSampler::output_netcdf_data(
-    const ncutils::NCGroup& /*unused*/, const size_t /*unused*/) const
+    const ncutils::NCGroup& /*unused*/,
+    const size_t /*unused*/,
+    const SamplerBase::SampleLocType& /*unused*/) const
 {}
 #endif
 
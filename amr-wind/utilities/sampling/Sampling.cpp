@@ -1,4 +1,6 @@
+#include <array>
 #include <memory>
+#include <numeric>
 #include <utility>
 
 #include "amr-wind/utilities/sampling/Sampling.H"
@@ -6,6 +8,7 @@
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
 #include "AMReX_ParmParse.H"
+#include "AMReX_ParallelContext.H"
 
 namespace amr_wind {
 namespace sampling {
@@ -14,7 +17,7 @@ Sampling::Sampling(CFDSim& sim, std::string label)
     : m_sim(sim), m_label(std::move(label))
 {}
 
-Sampling::~Sampling() = default;
+Sampling::~Sampling() { flush_netcdf(); }
 
 void Sampling::initialize()
 {
@@ -31,6 +34,10 @@ void Sampling::initialize()
         pp.getarr("fields", field_names);
         pp.query("output_frequency", m_out_freq);
         pp.query("output_format", m_out_fmt);
+#ifdef AMR_WIND_USE_NETCDF
+        pp.query("netcdf_buffer_depth", m_nc_buffer_depth);
+        pp.query("netcdf_parallel", m_nc_parallel);
+#endif
     }
 
     // Process field information
@@ -52,7 +59,6 @@ void Sampling::initialize()
 
     // Load different probe types, default probe type is line
     int idx = 0;
-    m_total_particles = 0;
     for (auto& lbl : labels) {
         const std::string key = m_label + "." + lbl;
         amrex::ParmParse pp1(key);
@@ -64,7 +70,6 @@ void Sampling::initialize()
         obj->id() = idx++;
         obj->initialize(key);
 
-        m_total_particles += obj->num_points();
         m_samplers.emplace_back(std::move(obj));
     }
 
@@ -79,6 +84,11 @@ void Sampling::update_container()
 {
     BL_PROFILE("amr-wind::Sampling::update_container");
 
+    m_total_particles = 0;
+    for (const auto& obj : m_samplers) {
+        m_total_particles += obj->num_points();
+    }
+
     // Initialize the particle container based on user inputs
     m_scontainer = std::make_unique<SamplingContainer>(m_sim.mesh());
     m_scontainer->setup_container(m_ncomp);
@@ -86,17 +96,31 @@ void Sampling::update_container()
     // Redistribute particles to appropriate boxes/MPI ranks
     m_scontainer->Redistribute();
     m_scontainer->num_sampling_particles() = m_total_particles;
+    m_container_needs_rebuild = false;
 }
 
 void Sampling::update_sampling_locations()
 {
     BL_PROFILE("amr-wind::Sampling::update_sampling_locations");
 
+    bool moved = false;
     for (const auto& obj : m_samplers) {
+        const int npts_old = obj->num_points();
         obj->update_sampling_locations();
+        moved = moved || obj->locations_changed();
+        // Samplers with a variable number of points require new particles
+        if (obj->num_points() != npts_old) {
+            m_container_needs_rebuild = true;
+        }
     }
 
-    update_container();
+    // The container persists across output steps; static probes only need a
+    // rebuild after regrid, moving probes are relocated in place.
+    if (m_container_needs_rebuild) {
+        update_container();
+    } else if (moved) {
+        m_scontainer->update_positions(m_samplers);
+    }
 }
 
 void Sampling::post_advance_work()
@@ -105,23 +129,27 @@ void Sampling::post_advance_work()
     BL_PROFILE("amr-wind::Sampling::post_advance_work");
     const auto& time = m_sim.time();
     const int tidx = time.time_index();
-    // Skip processing if it is not an output timestep
-    if (!(tidx % m_out_freq == 0)) {
-        return;
-    }
+    // Only process data on output timesteps
+    if (tidx % m_out_freq == 0) {
+        update_sampling_locations();
 
-    update_sampling_locations();
+        m_scontainer->interpolate_fields(m_fields);
 
-    m_scontainer->interpolate_fields(m_fields);
+        process_output();
+    }
 
-    process_output();
+    // Buffered output must be on disk before a restart file is written
+    if (time.write_checkpoint()) {
+        flush_netcdf();
+    }
 }
 
 void Sampling::post_regrid_actions()
 {
 
     BL_PROFILE("amr-wind::Sampling::post_regrid_actions");
-    m_scontainer->Redistribute();
+    // Defer the rebuild to the next output step
+    m_container_needs_rebuild = true;
 }
 
 void Sampling::process_output()
@@ -183,10 +211,16 @@ void Sampling::prepare_netcdf_file()
     }
     m_ncfile_name = post_dir + "/" + sname + ".nc";
 
-    // Only I/O processor handles NetCDF generation
-    if (!amrex::ParallelDescriptor::IOProcessor()) return;
+    // Only I/O processor handles NetCDF generation, unless all ranks write
+    // their own particles
+    if (!m_nc_parallel && !amrex::ParallelDescriptor::IOProcessor()) return;
 
-    auto ncf = ncutils::NCFile::create(m_ncfile_name, NC_CLOBBER | NC_NETCDF4);
+    auto ncf =
+        m_nc_parallel
+            ? ncutils::NCFile::create_par(
+                  m_ncfile_name, NC_CLOBBER | NC_NETCDF4 | NC_MPIIO,
+                  amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL)
+            : ncutils::NCFile::create(m_ncfile_name, NC_CLOBBER | NC_NETCDF4);
     const std::string nt_name = "num_time_steps";
     const std::string npart_name = "num_points";
     const std::vector<std::string> two_dim{nt_name, npart_name};
@@ -233,44 +267,182 @@ void Sampling::prepare_netcdf_file()
 void Sampling::write_netcdf()
 {
 #ifdef AMR_WIND_USE_NETCDF
-    std::vector<double> buf(m_total_particles * m_var_names.size(), 0.0);
-    m_scontainer->populate_buffer(buf);
+    BL_PROFILE("amr-wind::Sampling::write_netcdf");
+
+    NetCDFStep step;
+    step.time = m_sim.time().new_time();
+    for (const auto& obj : m_samplers) {
+        step.npts.push_back(obj->num_points());
+        step.locs.emplace_back();
+        if (obj->locations_changed()) {
+            obj->sampling_locations(step.locs.back());
+        }
+    }
+
+    if (m_nc_parallel) {
+        m_scontainer->populate_local_buffer(step.uids, step.data);
+    } else {
+        step.data.resize(m_total_particles * m_var_names.size(), 0.0);
+        m_scontainer->populate_buffer(step.data);
+
+        // Only the I/O processor holds the reduced data
+        if (!amrex::ParallelDescriptor::IOProcessor()) return;
+    }
+
+    m_nc_steps.push_back(std::move(step));
+    if (static_cast<int>(m_nc_steps.size()) >= m_nc_buffer_depth) {
+        flush_netcdf();
+    }
+#endif
+}
+
+void Sampling::flush_netcdf()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    if (m_out_fmt != "netcdf") return;
+
+    BL_PROFILE("amr-wind::Sampling::flush_netcdf");
+    if (m_nc_parallel) {
+        flush_netcdf_parallel();
+    } else {
+        flush_netcdf_serial();
+    }
+    m_nc_steps.clear();
+#endif
+}
+
+void Sampling::flush_netcdf_serial()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    if (m_nc_steps.empty()) return;
 
-    if (!amrex::ParallelDescriptor::IOProcessor()) return;
     auto ncf = ncutils::NCFile::open(m_ncfile_name, NC_WRITE);
     const std::string nt_name = "num_time_steps";
     // Index of the next timestep
-    const size_t nt = ncf.dim(nt_name).len();
-    {
-        auto time = m_sim.time().new_time();
-        ncf.var("time").put(&time, {nt}, {1});
+    size_t nt = ncf.dim(nt_name).len();
+
+    const int nvars = m_var_names.size();
+    const int nsamplers = m_samplers.size();
+    for (auto& step : m_nc_steps) {
+        ncf.var("time").put(&step.time, {nt}, {1});
+
+        for (int is = 0; is < nsamplers; ++is) {
+            auto grp = ncf.group(m_samplers[is]->label());
+            m_samplers[is]->output_netcdf_data(grp, nt, step.locs[is]);
+        }
+
+        std::vector<size_t> start{nt, 0};
+        std::vector<size_t> count{1, 0};
+        const int npart =
+            std::accumulate(step.npts.begin(), step.npts.end(), 0);
+
+        for (int iv = 0; iv < nvars; ++iv) {
+            start[1] = 0;
+            count[1] = 0;
+            int offset = iv * npart;
+            for (int is = 0; is < nsamplers; ++is) {
+                const auto& obj = m_samplers[is];
+                auto grp = ncf.group(obj->label());
+                auto var = grp.var(m_var_names[iv]);
+                // Do sampler specific output if needed
+                bool do_output =
+                    obj->output_netcdf_field(&step.data[offset], var);
+                // Do generic output if specific output returns true
+                if (do_output) {
+                    count[1] = step.npts[is];
+                    var.put(&step.data[offset], start, count);
+                    offset += count[1];
+                }
+            }
+        }
+        ++nt;
     }
+    ncf.close();
+#endif
+}
 
+void Sampling::flush_netcdf_parallel()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    // All ranks hold the same number of buffered steps
+    if (m_nc_steps.empty()) return;
+
+    auto ncf = ncutils::NCFile::open_par(
+        m_ncfile_name, NC_WRITE | NC_NETCDF4 | NC_MPIIO,
+        amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
+    const std::string nt_name = "num_time_steps";
+    size_t nt = ncf.dim(nt_name).len();
+
+    // Writes along the unlimited dimension must be collective
+    ncf.var("time").par_access(NC_COLLECTIVE);
     for (const auto& obj : m_samplers) {
-        auto grp = ncf.group(obj->label());
-        obj->output_netcdf_data(grp, nt);
+        for (const auto& var : ncf.group(obj->label()).all_vars()) {
+            var.par_access(NC_COLLECTIVE);
+        }
     }
 
-    std::vector<size_t> start{nt, 0};
-    std::vector<size_t> count{1, 0};
-
     const int nvars = m_var_names.size();
-    for (int iv = 0; iv < nvars; ++iv) {
-        start[1] = 0;
-        count[1] = 0;
-        int offset = iv * m_scontainer->num_sampling_particles();
-        for (const auto& obj : m_samplers) {
-            auto grp = ncf.group(obj->label());
-            auto var = grp.var(m_var_names[iv]);
-            // Do sampler specific output if needed
-            bool do_output = obj->output_netcdf_field(&buf[offset], var);
-            // Do generic output if specific output returns true
-            if (do_output) {
-                count[1] = obj->num_points();
-                var.put(&buf[offset], start, count);
-                offset += count[1];
+    const int nsamplers = m_samplers.size();
+    for (auto& step : m_nc_steps) {
+        ncf.var("time").put(&step.time, {nt}, {1});
+
+        // Sampler metadata is replicated, every rank writes the same values
+        for (int is = 0; is < nsamplers; ++is) {
+            auto grp = ncf.group(m_samplers[is]->label());
+            m_samplers[is]->output_netcdf_data(grp, nt, step.locs[is]);
+        }
+
+        // Split the local particles into contiguous ranges within each sampler
+        std::vector<int> soffset(nsamplers + 1, 0);
+        std::partial_sum(
+            step.npts.begin(), step.npts.end(), soffset.begin() + 1);
+        // (sampler, start within sampler, start in local buffer, count)
+        std::vector<std::array<int, 4>> runs;
+        const int nlocal = step.uids.size();
+        int is = 0;
+        for (int i = 0; i < nlocal; ++i) {
+            const int uid = step.uids[i];
+            while (uid >= soffset[is + 1]) {
+                ++is;
+            }
+            if (runs.empty() || (runs.back()[0] != is) ||
+                (soffset[is] + runs.back()[1] + runs.back()[3] != uid)) {
+                runs.push_back({is, uid - soffset[is], i, 0});
+            }
+            ++runs.back()[3];
+        }
+
+        // Collective writes require the same number of calls on all ranks
+        std::vector<int> nruns(nsamplers, 0);
+        for (const auto& r : runs) {
+            ++nruns[r[0]];
+        }
+        std::vector<int> nruns_max(nruns);
+        amrex::ParallelDescriptor::ReduceIntMax(nruns_max.data(), nsamplers);
+
+        std::vector<size_t> start{nt, 0};
+        std::vector<size_t> count{1, 0};
+        const double dummy = 0.0;
+        for (int iv = 0; iv < nvars; ++iv) {
+            auto irun = runs.begin();
+            for (int js = 0; js < nsamplers; ++js) {
+                auto var =
+                    ncf.group(m_samplers[js]->label()).var(m_var_names[iv]);
+                for (int ir = 0; ir < nruns_max[js]; ++ir) {
+                    if (ir < nruns[js]) {
+                        const auto& r = *(irun++);
+                        start[1] = r[1];
+                        count[1] = r[3];
+                        var.put(&step.data[iv * nlocal + r[2]], start, count);
+                    } else {
+                        start[1] = 0;
+                        count[1] = 0;
+                        var.put(&dummy, start, count);
+                    }
+                }
             }
         }
+        ++nt;
     }
     ncf.close();
 #endif
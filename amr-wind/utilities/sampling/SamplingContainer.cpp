@@ -3,70 +3,117 @@
 #include "amr-wind/utilities/sampling/SamplerBase.H"
 #include "amr-wind/core/Field.H"
 
+#include <algorithm>
+#include <numeric>
+
 namespace amr_wind {
 namespace sampling {
 
 namespace {
 
-/** Interpolate a field to the sampling locations
+//! Offsets of the data location within a cell, in units of cell size
+amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> field_offset(const FieldLoc floc)
+{
+    switch (floc) {
+    case FieldLoc::NODE:
+        return {{0.0, 0.0, 0.0}};
+    case FieldLoc::XFACE:
+        return {{0.0, 0.5, 0.5}};
+    case FieldLoc::YFACE:
+        return {{0.5, 0.0, 0.5}};
+    case FieldLoc::ZFACE:
+        return {{0.5, 0.5, 0.0}};
+    case FieldLoc::CELL:
+        break;
+    }
+    return {{0.5, 0.5, 0.5}};
+}
+
+/** Interpolate all components of all fields to the sampling locations
+ *
+ *  The containing cell and the trilinear weights are computed once per
+ *  particle and reused for every field sharing the same data location, all
+ *  components are written to the SoA particle storage in a single launch.
  *
  *  \param np Number of particles in the container
- *  \param ic Component of the field to be interpolated
- *  \param pvec Vector containing particle info
- *  \param pavec Array information for the real component data
- *  \param farr Array of field data for this multifab
+ *  \param nfields Number of fields to be interpolated
+ *  \param pstruct Particle data
+ *  \param farrs Array information for the fields on this box
+ *  \param ncomps Number of components for each field
+ *  \param offsets Offsets for cell/node/face fields (nfields * AMREX_SPACEDIM)
+ *  \param parrs Pointers to the real component data for each output variable
+ *  \param problo Lower corner of the domain
  *  \param dxi Inverse cell size array
  *  \param dx Cell size array
- *  \param offset Offsets for cell/node/face fields
  */
-void sample_field(
+void sample_fields(
     const int np,
-    const int ic,
-    SamplingContainer::ParticleVector& pvec,
-    SamplingContainer::RealVector& pavec,
-    const amrex::Array4<const amrex::Real>& farr,
+    const int nfields,
+    const SamplingContainer::ParticleType* pstruct,
+    const amrex::Array4<const amrex::Real>* farrs,
+    const int* ncomps,
+    const amrex::Real* offsets,
+    amrex::Real* const* parrs,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& problo,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dxi,
-    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
-    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& offset)
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx)
 {
     BL_PROFILE("amr-wind::SamplingContainer::sample_impl");
 
-    auto* pstruct = pvec.data();
-    auto* parr = &(pavec[0]);
-
     amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(int ip) noexcept {
-        auto& p = pstruct[ip];
-        // Determine offsets within the containing cell
-        const amrex::Real x =
-            (p.pos(0) - problo[0] - offset[0] * dx[0]) * dxi[0];
-        const amrex::Real y =
-            (p.pos(1) - problo[1] - offset[1] * dx[1]) * dxi[1];
-        const amrex::Real z =
-            (p.pos(2) - problo[2] - offset[2] * dx[2]) * dxi[2];
-
-        // Index of the low corner
-        const int i = static_cast<int>(amrex::Math::floor(x));
-        const int j = static_cast<int>(amrex::Math::floor(y));
-        const int k = static_cast<int>(amrex::Math::floor(z));
-
-        // Interpolation weights in each direction (linear basis)
-        const amrex::Real wx_hi = (x - i);
-        const amrex::Real wy_hi = (y - j);
-        const amrex::Real wz_hi = (z - k);
-
-        const amrex::Real wx_lo = 1.0 - wx_hi;
-        const amrex::Real wy_lo = 1.0 - wy_hi;
-        const amrex::Real wz_lo = 1.0 - wz_hi;
-
-        parr[ip] = wx_lo * wy_lo * wz_lo * farr(i, j, k, ic) +
-                   wx_lo * wy_lo * wz_hi * farr(i, j, k + 1, ic) +
-                   wx_lo * wy_hi * wz_lo * farr(i, j + 1, k, ic) +
-                   wx_lo * wy_hi * wz_hi * farr(i, j + 1, k + 1, ic) +
-                   wx_hi * wy_lo * wz_lo * farr(i + 1, j, k, ic) +
-                   wx_hi * wy_lo * wz_hi * farr(i + 1, j, k + 1, ic) +
-                   wx_hi * wy_hi * wz_lo * farr(i + 1, j + 1, k, ic) +
-                   wx_hi * wy_hi * wz_hi * farr(i + 1, j + 1, k + 1, ic);
+        const auto& p = pstruct[ip];
+
+        int i = 0, j = 0, k = 0;
+        amrex::Real wx_hi = 0.0, wy_hi = 0.0, wz_hi = 0.0;
+        amrex::Real wx_lo = 0.0, wy_lo = 0.0, wz_lo = 0.0;
+        // Offsets used for the current weights, invalid to force computation
+        amrex::Real loff[AMREX_SPACEDIM] = {-1.0, -1.0, -1.0};
+
+        int iout = 0;
+        for (int nf = 0; nf < nfields; ++nf) {
+            const amrex::Real* foff = &offsets[nf * AMREX_SPACEDIM];
+            if ((foff[0] != loff[0]) || (foff[1] != loff[1]) ||
+                (foff[2] != loff[2])) {
+                // Determine offsets within the containing cell
+                const amrex::Real x =
+                    (p.pos(0) - problo[0] - foff[0] * dx[0]) * dxi[0];
+                const amrex::Real y =
+                    (p.pos(1) - problo[1] - foff[1] * dx[1]) * dxi[1];
+                const amrex::Real z =
+                    (p.pos(2) - problo[2] - foff[2] * dx[2]) * dxi[2];
+
+                // Index of the low corner
+                i = static_cast<int>(amrex::Math::floor(x));
+                j = static_cast<int>(amrex::Math::floor(y));
+                k = static_cast<int>(amrex::Math::floor(z));
+
+                // Interpolation weights in each direction (linear basis)
+                wx_hi = (x - i);
+                wy_hi = (y - j);
+                wz_hi = (z - k);
+
+                wx_lo = 1.0 - wx_hi;
+                wy_lo = 1.0 - wy_hi;
+                wz_lo = 1.0 - wz_hi;
+
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    loff[n] = foff[n];
+                }
+            }
+
+            const auto& farr = farrs[nf];
+            for (int ic = 0; ic < ncomps[nf]; ++ic) {
+                parrs[iout++][ip] =
+                    wx_lo * wy_lo * wz_lo * farr(i, j, k, ic) +
+                    wx_lo * wy_lo * wz_hi * farr(i, j, k + 1, ic) +
+                    wx_lo * wy_hi * wz_lo * farr(i, j + 1, k, ic) +
+                    wx_lo * wy_hi * wz_hi * farr(i, j + 1, k + 1, ic) +
+                    wx_hi * wy_lo * wz_lo * farr(i + 1, j, k, ic) +
+                    wx_hi * wy_lo * wz_hi * farr(i + 1, j, k + 1, ic) +
+                    wx_hi * wy_hi * wz_lo * farr(i + 1, j + 1, k, ic) +
+                    wx_hi * wy_hi * wz_hi * farr(i + 1, j + 1, k + 1, ic);
+            }
+        }
     });
 }
 } // namespace
@@ -153,12 +200,89 @@ void SamplingContainer::initialize_particles(
     AMREX_ALWAYS_ASSERT(pidx == num_particles);
 }
 
+void SamplingContainer::update_positions(
+    const amrex::Vector<std::unique_ptr<SamplerBase>>& samplers)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::update_positions");
+
+    // Gather locations of all samplers in UID order
+    amrex::Vector<amrex::Real> all_locs;
+    all_locs.reserve(m_total_particles * AMREX_SPACEDIM);
+    SamplerBase::SampleLocType locs;
+    for (const auto& probe : samplers) {
+        locs.clear();
+        probe->sampling_locations(locs);
+        for (int ip = 0; ip < probe->num_points(); ++ip) {
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                all_locs.push_back(locs[ip][n]);
+            }
+        }
+    }
+    AMREX_ALWAYS_ASSERT(
+        static_cast<int>(all_locs.size()) ==
+        m_total_particles * AMREX_SPACEDIM);
+
+    amrex::Gpu::DeviceVector<amrex::Real> dlocs(all_locs.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, all_locs.begin(), all_locs.end(),
+        dlocs.begin());
+    const auto* dpos = dlocs.data();
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::ParallelFor(
+                np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                    auto& pp = pstruct[ip];
+                    const int uid = pp.idata(IIx::uid);
+                    for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                        pp.pos(n) = dpos[uid * AMREX_SPACEDIM + n];
+                    }
+                });
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+
+    Redistribute();
+}
+
 void SamplingContainer::interpolate_fields(const amrex::Vector<Field*> fields)
 {
     BL_PROFILE("amr-wind::SamplingContainer::interpolate");
 
-    const int nlevels = m_mesh.finestLevel() + 1;
+    const int nfields = fields.size();
+    if (nfields < 1) return;
+
+    // Field metadata is independent of level and box
+    amrex::Vector<int> h_ncomps(nfields);
+    amrex::Vector<amrex::Real> h_offsets(nfields * AMREX_SPACEDIM);
+    int ncomp_total = 0;
+    for (int nf = 0; nf < nfields; ++nf) {
+        const auto offset = field_offset(fields[nf]->field_location());
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            h_offsets[nf * AMREX_SPACEDIM + n] = offset[n];
+        }
+        h_ncomps[nf] = fields[nf]->num_comp();
+        ncomp_total += h_ncomps[nf];
+    }
+    AMREX_ALWAYS_ASSERT(ncomp_total <= NumRuntimeRealComps());
+    amrex::Gpu::DeviceVector<int> d_ncomps(nfields);
+    amrex::Gpu::DeviceVector<amrex::Real> d_offsets(h_offsets.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_ncomps.begin(), h_ncomps.end(),
+        d_ncomps.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_offsets.begin(), h_offsets.end(),
+        d_offsets.begin());
+    const auto* ncomps = d_ncomps.data();
+    const auto* offsets = d_offsets.data();
 
+    const int nlevels = m_mesh.finestLevel() + 1;
+    amrex::Vector<amrex::Array4<const amrex::Real>> h_farrs(nfields);
+    amrex::Vector<amrex::Real*> h_parrs(ncomp_total);
     for (int lev = 0; lev < nlevels; ++lev) {
         const auto& geom = m_mesh.Geom(lev);
         const auto dx = geom.CellSizeArray();
@@ -167,59 +291,27 @@ void SamplingContainer::interpolate_fields(const amrex::Vector<Field*> fields)
 
         for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
             const int np = pti.numParticles();
-            auto& pvec = pti.GetArrayOfStructs()();
-
-            int fidx = 0;
-            for (const auto* fld : fields) {
-                const auto farr = (*fld)(lev).const_array(pti);
-                for (int ic = 0; ic < fld->num_comp(); ++ic) {
-                    auto& parr = pti.GetStructOfArrays().GetRealData(fidx++);
-
-                    switch (fld->field_location()) {
-                    case FieldLoc::NODE: {
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> offset{
-                            {0.0, 0.0, 0.0}};
-                        sample_field(
-                            np, ic, pvec, parr, farr, plo, dxi, dx, offset);
-                        break;
-                    }
-
-                    case FieldLoc::CELL: {
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> offset{
-                            {0.5, 0.5, 0.5}};
-                        sample_field(
-                            np, ic, pvec, parr, farr, plo, dxi, dx, offset);
-                        break;
-                    }
+            if (np < 1) continue;
+            const auto* pstruct = pti.GetArrayOfStructs()().data();
 
-                    case FieldLoc::XFACE: {
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> offset{
-                            {0.0, 0.5, 0.5}};
-                        sample_field(
-                            np, ic, pvec, parr, farr, plo, dxi, dx, offset);
-                        break;
-                    }
+            for (int nf = 0; nf < nfields; ++nf) {
+                h_farrs[nf] = (*fields[nf])(lev).const_array(pti);
+            }
+            auto& soa = pti.GetStructOfArrays();
+            for (int ic = 0; ic < ncomp_total; ++ic) {
+                h_parrs[ic] = soa.GetRealData(ic).data();
+            }
 
-                    case FieldLoc::YFACE: {
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> offset{
-                            {0.5, 0.0, 0.5}};
-                        sample_field(
-                            np, ic, pvec, parr, farr, plo, dxi, dx, offset);
-                        break;
-                    }
+            amrex::AsyncArray<amrex::Array4<const amrex::Real>> farrs(
+                h_farrs.data(), nfields);
+            amrex::AsyncArray<amrex::Real*> parrs(h_parrs.data(), ncomp_total);
 
-                    case FieldLoc::ZFACE: {
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> offset{
-                            {0.5, 0.5, 0.0}};
-                        sample_field(
-                            np, ic, pvec, parr, farr, plo, dxi, dx, offset);
-                        break;
-                    }
-                    }
-                }
-            }
+            sample_fields(
+                np, nfields, pstruct, farrs.data(), ncomps, offsets,
+                parrs.data(), plo, dxi, dx);
         }
     }
+    amrex::Gpu::streamSynchronize();
 }
 
 void SamplingContainer::populate_buffer(std::vector<double>& buf)
@@ -254,5 +346,68 @@ void SamplingContainer::populate_buffer(std::vector<double>& buf)
         buf.data(), buf.size(), amrex::ParallelDescriptor::IOProcessorNumber());
 }
 
+void SamplingContainer::populate_local_buffer(
+    std::vector<int>& uids, std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_local_buffer");
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+    const int ncomp = NumRuntimeRealComps();
+    int nlocal = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            nlocal += pti.numParticles();
+        }
+    }
+
+    amrex::Gpu::DeviceVector<int> duids(nlocal);
+    amrex::Gpu::DeviceVector<double> dbuf(nlocal * ncomp);
+    auto* duid_ptr = duids.data();
+    auto* dbuf_ptr = dbuf.data();
+    int pidx = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            const auto* pstruct = pti.GetArrayOfStructs()().data();
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                duid_ptr[pidx + ip] = pstruct[ip].idata(IIx::uid);
+            });
+            for (int fid = 0; fid < ncomp; ++fid) {
+                const auto* parr =
+                    pti.GetStructOfArrays().GetRealData(fid).data();
+                const int offset = fid * nlocal + pidx;
+                amrex::ParallelFor(
+                    np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                        dbuf_ptr[offset + ip] = parr[ip];
+                    });
+            }
+            pidx += np;
+        }
+    }
+
+    std::vector<int> huids(nlocal);
+    std::vector<double> hbuf(nlocal * ncomp);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, duids.begin(), duids.end(), huids.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, dbuf.begin(), dbuf.end(), hbuf.begin());
+
+    // Sort by UID so that the data maps to contiguous ranges in the output
+    std::vector<int> order(nlocal);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&huids](const int a, const int b) {
+        return huids[a] < huids[b];
+    });
+
+    uids.resize(nlocal);
+    buf.resize(nlocal * ncomp);
+    for (int i = 0; i < nlocal; ++i) {
+        uids[i] = huids[order[i]];
+        for (int fid = 0; fid < ncomp; ++fid) {
+            buf[fid * nlocal + i] = hbuf[fid * nlocal + order[i]];
+        }
+    }
+}
+
 } // namespace sampling
 } // namespace amr_wind
@@ -2,6 +2,7 @@
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include "amr-wind/physics/multiphase/MultiPhase.H"
+#include "amr-wind/core/field_ops.H"
 #include <AMReX_MultiFabUtil.H>
 #include <utility>
 #include "AMReX_ParmParse.H"
@@ -38,70 +39,13 @@ void WaveEnergy::initialize()
     prepare_ascii_file();
 }
 
-amrex::Real WaveEnergy::calculate_kinetic_energy()
+void WaveEnergy::calculate_energy(amrex::Real& ke, amrex::Real& pe)
 {
-    BL_PROFILE("amr-wind::WaveEnergy::calculate_kinetic_energy");
+    BL_PROFILE("amr-wind::WaveEnergy::calculate_energy");
 
-    // integrated total wave Energy
-    amrex::Real wave_ke = 0.0;
+    // integrated total wave kinetic and potential energy
+    amrex::GpuArray<amrex::Real, 2> wave_energy = {{0.0, 0.0}};
 
-    // Liquid density
-    const amrex::Real rho_liq = m_rho1;
-
-    const int finest_level = m_velocity.repo().num_active_levels() - 1;
-    const auto& geom = m_velocity.repo().mesh().Geom();
-
-    for (int lev = 0; lev <= finest_level; lev++) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        wave_ke += amrex::ReduceSum(
-            m_vof(lev), m_velocity(lev), level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& vof_arr,
-                amrex::Array4<amrex::Real const> const& vel_arr,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real Wave_Energy_Fab = 0.0;
-
-                amrex::Loop(
-                    bx, [=, &Wave_Energy_Fab](int i, int j, int k) noexcept {
-                        Wave_Energy_Fab +=
-                            cell_vol * mask_arr(i, j, k) * 0.5 * rho_liq *
-                            vof_arr(i, j, k) *
-                            (vel_arr(i, j, k, 0) * vel_arr(i, j, k, 0) +
-                             vel_arr(i, j, k, 1) * vel_arr(i, j, k, 1) +
-                             vel_arr(i, j, k, 2) * vel_arr(i, j, k, 2));
-                    });
-                return Wave_Energy_Fab;
-            });
-    }
-
-    amrex::ParallelDescriptor::ReduceRealSum(wave_ke);
-
-    return wave_ke;
-}
-
-amrex::Real WaveEnergy::calculate_potential_energy()
-{
-    BL_PROFILE("amr-wind::WaveEnergy::calculate_potential_energy");
-
-    // integrated total wave Energy
-    amrex::Real wave_pe = 0.0;
     // Liquid density
     const amrex::Real rho_liq = m_rho1;
     // gravity constant
@@ -112,18 +56,6 @@ amrex::Real WaveEnergy::calculate_potential_energy()
 
     for (int lev = 0; lev <= finest_level; lev++) {
 
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
         const amrex::Real cell_vol = geom[lev].CellSize()[0] *
                                      geom[lev].CellSize()[1] *
                                      geom[lev].CellSize()[2];
@@ -131,34 +63,38 @@ amrex::Real WaveEnergy::calculate_potential_energy()
         const amrex::Real dz = geom[lev].CellSize()[2];
         const amrex::Real probloz = geom[lev].ProbLo()[2];
 
-        wave_pe += amrex::ReduceSum(
-            m_vof(lev), level_mask, 0,
+        const auto& vof = m_vof(lev).const_arrays();
+        const auto& vel = m_velocity(lev).const_arrays();
+        const auto lev_energy = field_ops::masked_level_sum<2>(
+            m_sim.repo(), lev,
             [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& vof_arr,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real Wave_Energy_Fab = 0.0;
-
-                amrex::Loop(
-                    bx, [=, &Wave_Energy_Fab](int i, int j, int k) noexcept {
-                        // Crude model of liquid height in multiphase cells
-                        amrex::Real kk =
-                            (vof_arr(i, j, k + 1) > vof_arr(i, j, k)) ? k + 1
-                                                                      : k;
-                        amrex::Real dir =
-                            (vof_arr(i, j, k + 1) > vof_arr(i, j, k)) ? -1 : 1;
-                        const amrex::Real zl =
-                            probloz + (kk + dir * 0.5 * vof_arr(i, j, k)) * dz;
-                        Wave_Energy_Fab += cell_vol * mask_arr(i, j, k) *
-                                           rho_liq * vof_arr(i, j, k) * g * zl;
-                    });
-                return Wave_Energy_Fab;
+                int nbx, int i, int j, int k,
+                amrex::GpuArray<amrex::Real, 2>& qty) noexcept {
+                const auto& vof_arr = vof[nbx];
+                const auto& vel_arr = vel[nbx];
+                qty[0] = cell_vol * 0.5 * rho_liq * vof_arr(i, j, k) *
+                         (vel_arr(i, j, k, 0) * vel_arr(i, j, k, 0) +
+                          vel_arr(i, j, k, 1) * vel_arr(i, j, k, 1) +
+                          vel_arr(i, j, k, 2) * vel_arr(i, j, k, 2));
+
+                // Crude model of liquid height in multiphase cells
+                amrex::Real kk =
+                    (vof_arr(i, j, k + 1) > vof_arr(i, j, k)) ? k + 1 : k;
+                amrex::Real dir =
+                    (vof_arr(i, j, k + 1) > vof_arr(i, j, k)) ? -1 : 1;
+                const amrex::Real zl =
+                    probloz + (kk + dir * 0.5 * vof_arr(i, j, k)) * dz;
+                qty[1] = cell_vol * rho_liq * vof_arr(i, j, k) * g * zl;
             });
+        wave_energy[0] += lev_energy[0];
+        wave_energy[1] += lev_energy[1];
     }
 
-    amrex::ParallelDescriptor::ReduceRealSum(wave_pe);
+    amrex::ParallelAllReduce::Sum(
+        wave_energy.data(), 2, amrex::ParallelContext::CommunicatorSub());
 
-    return wave_pe;
+    ke = wave_energy[0];
+    pe = wave_energy[1];
 }
 
 void WaveEnergy::post_advance_work()
@@ -171,8 +107,8 @@ void WaveEnergy::post_advance_work()
         return;
     }
 
-    m_wave_kinetic_energy = calculate_kinetic_energy();
-    m_wave_potential_energy = calculate_potential_energy() + m_pe_off;
+    calculate_energy(m_wave_kinetic_energy, m_wave_potential_energy);
+    m_wave_potential_energy += m_pe_off;
 
     write_ascii();
 }
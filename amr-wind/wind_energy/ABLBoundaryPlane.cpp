@@ -5,6 +5,7 @@
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include <AMReX_PlotFileUtil.H>
+#include <AMReX_VisMF.H>
 
 namespace amr_wind {
 
@@ -74,6 +75,20 @@ void InletData::resize(const int size)
     m_data_interp.resize(size);
 }
 
+void InletData::reset()
+{
+    m_data_n.clear();
+    m_data_np1.clear();
+    m_data_interp.clear();
+    m_cache.clear();
+    m_cache_begin = 0;
+    m_cache_end = 0;
+    m_idx = -1;
+    m_tn = -1.0;
+    m_tnp1 = -1.0;
+    m_tinterp = -1.0;
+}
+
 void InletData::define_plane(const amrex::Orientation ori)
 {
     m_data_n[ori] = std::make_unique<PlaneVector>();
@@ -82,14 +97,32 @@ void InletData::define_plane(const amrex::Orientation ori)
 }
 
 void InletData::define_level_data(
-    const amrex::Orientation ori, const amrex::Box& bx, const size_t nc)
+    const amrex::Orientation ori,
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm,
+    const size_t nc)
 {
     if (!this->is_populated(ori)) {
         return;
     }
-    m_data_n[ori]->push_back(amrex::FArrayBox(bx, nc));
-    m_data_np1[ori]->push_back(amrex::FArrayBox(bx, nc));
-    m_data_interp[ori]->push_back(amrex::FArrayBox(bx, nc));
+    m_data_n[ori]->emplace_back(ba, dm, nc, 0);
+    m_data_np1[ori]->emplace_back(ba, dm, nc, 0);
+    m_data_interp[ori]->emplace_back(ba, dm, nc, 0);
+}
+
+bool InletData::advance(const int idx, const amrex::Vector<amrex::Real>& times)
+{
+    const bool shifted = (m_idx >= 0) && (idx == m_idx + 1);
+    if (shifted) {
+        // The old n + 1 planes become the new n planes
+        std::swap(m_data_n, m_data_np1);
+    }
+
+    m_idx = idx;
+    m_tn = times[idx];
+    m_tnp1 = times[idx + 1];
+    AMREX_ALWAYS_ASSERT(m_tn < m_tnp1);
+    return shifted;
 }
 
 #ifdef AMR_WIND_USE_NETCDF
@@ -97,67 +130,125 @@ void InletData::read_data(
     ncutils::NCGroup& grp,
     const amrex::Orientation ori,
     const int lev,
+    const amrex::IntVect& origin,
     const Field* fld,
-    const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const int idx,
+    const int nslices)
 {
+    BL_PROFILE("amr-wind::InletData::read_data");
     const size_t nc = fld->num_comp();
-    const int nstart = m_components[fld->id()];
+    const int normal = ori.coordDir();
+    const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
 
-    const int idx = closest_index(times, time);
-    const int idxp1 = idx + 1;
-    m_tn = times[idx];
-    m_tnp1 = times[idxp1];
-    AMREX_ALWAYS_ASSERT(((m_tn <= time) && (time <= m_tnp1)));
+    // Only the boxes of the plane owned by this rank are read, the slices of
+    // each box are stored one after the other in the cache
+    const auto& mfab = (*m_data_n[ori])[lev];
+    size_t total = 0;
+    for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+        total += nslices * mfi.validbox().numPts() * nc;
+    }
+    auto& buffer =
+        m_cache[{static_cast<int>(ori), lev, static_cast<int>(fld->id())}];
+    buffer.resize(total);
+
+    // Collective reads require the same number of calls on all ranks
+    const int nboxes = mfab.local_size();
+    int nboxes_max = nboxes;
+    amrex::ParallelDescriptor::ReduceIntMax(nboxes_max);
+
+    auto var = grp.var(fld->name());
+    var.par_access(NC_COLLECTIVE);
+    amrex::Vector<size_t> start{static_cast<size_t>(idx), 0, 0, 0};
+    amrex::Vector<size_t> count{static_cast<size_t>(nslices), 0, 0, nc};
+    size_t offset = 0;
+    for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        start[1] = bx.smallEnd(perp[0]) - origin[perp[0]];
+        start[2] = bx.smallEnd(perp[1]) - origin[perp[1]];
+        count[1] = bx.length(perp[0]);
+        count[2] = bx.length(perp[1]);
+        var.get(buffer.data() + offset, start, count);
+        offset += nslices * count[1] * count[2] * nc;
+    }
+
+    const amrex::Vector<size_t> zeros{0, 0, 0, 0};
+    amrex::Real dummy = 0.0;
+    for (int ib = nboxes; ib < nboxes_max; ++ib) {
+        var.get(&dummy, zeros, zeros);
+    }
+}
 
+void InletData::fill_planes(
+    const amrex::Orientation ori,
+    const int lev,
+    const Field* fld,
+    const bool shifted)
+{
+    BL_PROFILE("amr-wind::InletData::fill_planes");
+    AMREX_ALWAYS_ASSERT(is_cached(shifted ? m_idx + 1 : m_idx, m_idx + 2));
+
+    const size_t nc = fld->num_comp();
+    const int nstart = m_components[fld->id()];
     const int normal = ori.coordDir();
     const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
+    const int nslices = m_cache_end - m_cache_begin;
+
+    const auto& buffer = m_cache.at(
+        {static_cast<int>(ori), lev, static_cast<int>(fld->id())});
+    amrex::Gpu::DeviceVector<amrex::Real> d_slices(buffer.size() / nslices);
+    auto copy_slice = [&](amrex::MultiFab& mfab, const int idx) {
+        // Upload the slice of every local box straight to the device
+        size_t h_offset = 0;
+        size_t d_offset = 0;
+        for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+            const size_t slice_size = mfi.validbox().numPts() * nc;
+            const auto* h_slice =
+                buffer.data() + h_offset + (idx - m_cache_begin) * slice_size;
+            amrex::Gpu::copyAsync(
+                amrex::Gpu::hostToDevice, h_slice, h_slice + slice_size,
+                d_slices.begin() + d_offset);
+            h_offset += nslices * slice_size;
+            d_offset += slice_size;
+        }
 
-    const auto& bx = (*m_data_n[ori])[lev].box();
-    const auto& lo = bx.loVect();
-    const size_t n0 = bx.length(perp[0]);
-    const size_t n1 = bx.length(perp[1]);
-
-    amrex::Vector<size_t> start{
-        static_cast<size_t>(idx), static_cast<size_t>(lo[perp[0]]),
-        static_cast<size_t>(lo[perp[1]]), 0};
-    amrex::Vector<size_t> count{1, n0, n1, nc};
-    amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
-    grp.var(fld->name()).get(buffer.data(), start, count);
+        d_offset = 0;
+        for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            const amrex::GpuArray<int, 2> plo{
+                bx.smallEnd(perp[0]), bx.smallEnd(perp[1])};
+            const int n1 = bx.length(perp[1]);
+            const auto* d_buffer = d_slices.data() + d_offset;
+            const auto& dat = mfab.array(mfi);
+            amrex::ParallelFor(
+                bx, nc,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                    const int i0 = plane_idx(i, j, k, perp[0], plo[0]);
+                    const int i1 = plane_idx(i, j, k, perp[1], plo[1]);
+                    dat(i, j, k, n + nstart) =
+                        d_buffer[((i0 * n1) + i1) * nc + n];
+                });
+            d_offset += bx.numPts() * nc;
+        }
+        amrex::Gpu::streamSynchronize();
+    };
 
-    const auto& datn = ((*m_data_n[ori])[lev]).array();
-    auto d_buffer = buffer.dataPtr();
-    amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
-        const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-        const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datn(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
-    });
-
-    start[0] = static_cast<size_t>(idxp1);
-    grp.var(fld->name()).get(buffer.data(), start, count);
-
-    const auto& datnp1 = ((*m_data_np1[ori])[lev]).array();
-    amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
-        const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-        const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datnp1(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
-    });
-
-    ((*m_data_n[ori])[lev]).prefetchToDevice();
-    ((*m_data_np1[ori])[lev]).prefetchToDevice();
+    if (!shifted) {
+        copy_slice((*m_data_n[ori])[lev], m_idx);
+    }
+    copy_slice((*m_data_np1[ori])[lev], m_idx + 1);
 }
-
 #endif
 
 void InletData::read_data_native(
-    const amrex::OrientationIter oit,
-    amrex::BndryRegister& bndry_n,
-    amrex::BndryRegister& bndry_np1,
+    const amrex::Orientation ori,
+    const amrex::MultiFab& bndry_n,
+    const amrex::MultiFab& bndry_np1,
     const int lev,
     const Field* fld,
     const amrex::Real time,
     const amrex::Vector<amrex::Real>& times)
 {
+    BL_PROFILE("amr-wind::InletData::read_data_native");
     const size_t nc = fld->num_comp();
     const int nstart = m_components[fld->id()];
 
@@ -167,64 +258,45 @@ void InletData::read_data_native(
     m_tn = times[idx];
     m_tnp1 = times[idxp1];
 
-    auto ori = oit();
-
     AMREX_ALWAYS_ASSERT(((m_tn <= time) && (time <= m_tnp1)));
-    AMREX_ALWAYS_ASSERT(fld->num_comp() == bndry_n[ori].nComp());
-    AMREX_ASSERT(bndry_n[ori].boxArray() == bndry_np1[ori].boxArray());
+    AMREX_ALWAYS_ASSERT(fld->num_comp() == bndry_n.nComp());
+    AMREX_ASSERT(bndry_n.boxArray() == bndry_np1.boxArray());
 
     const int normal = ori.coordDir();
-    const auto& bbx = (*m_data_n[ori])[lev].box();
     const amrex::IntVect v_offset = offset(ori.faceDir(), normal);
 
-    amrex::MultiFab bndry(
-        bndry_n[ori].boxArray(), bndry_n[ori].DistributionMap(),
-        bndry_n[ori].nComp(), 0, amrex::MFInfo());
-
-    for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
-
-        const auto& vbx = mfi.validbox();
-        const auto& bndry_n_arr = bndry_n[ori].array(mfi);
-        const auto& bndry_arr = bndry.array(mfi);
-
-        const auto& bx = bbx & vbx;
-        if (bx.isEmpty()) {
-            continue;
-        }
-
-        amrex::ParallelFor(
-            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                bndry_arr(i, j, k, n) =
-                    0.5 *
-                    (bndry_n_arr(i, j, k, n) +
-                     bndry_n_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
-            });
+    // Ghost cells and first interior cells on the decomposition of the planes
+    auto& dat_n = (*m_data_n[ori])[lev];
+    auto& dat_np1 = (*m_data_np1[ori])[lev];
+    amrex::BoxArray ba(dat_n.boxArray());
+    if (ori.isLow()) {
+        ba.growHi(normal, 1);
+    } else {
+        ba.growLo(normal, 1);
     }
+    amrex::MultiFab bndry(ba, dat_n.DistributionMap(), nc, 0);
 
-    bndry.copyTo((*m_data_n[ori])[lev], 0, nstart, nc);
-
-    for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
-        const auto& vbx = mfi.validbox();
-        const auto& bndry_np1_arr = bndry_np1[ori].array(mfi);
-        const auto& bndry_arr = bndry.array(mfi);
+    // Boundary value is the average of the ghost and first interior cells
+    auto fill_plane = [&](const amrex::MultiFab& src, amrex::MultiFab& dst) {
+        bndry.ParallelCopy(src, 0, 0, nc);
 
-        const auto& bx = bbx & vbx;
-        if (bx.isEmpty()) {
-            continue;
+        for (amrex::MFIter mfi(dst); mfi.isValid(); ++mfi) {
+            const auto& bndry_arr = bndry.const_array(mfi);
+            const auto& dst_arr = dst.array(mfi);
+            amrex::ParallelFor(
+                mfi.validbox(), nc,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                    dst_arr(i, j, k, n + nstart) =
+                        0.5 * (bndry_arr(i, j, k, n) +
+                               bndry_arr(
+                                   i + v_offset[0], j + v_offset[1],
+                                   k + v_offset[2], n));
+                });
         }
+    };
 
-        amrex::ParallelFor(
-            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                bndry_arr(i, j, k, n) =
-                    0.5 *
-                    (bndry_np1_arr(i, j, k, n) +
-                     bndry_np1_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
-            });
-    }
-
-    bndry.copyTo((*m_data_np1[ori])[lev], 0, nstart, nc);
+    fill_plane(bndry_n, dat_n);
+    fill_plane(bndry_np1, dat_np1);
 }
 
 void InletData::interpolate(const amrex::Real time)
@@ -242,9 +314,11 @@ void InletData::interpolate(const amrex::Real time)
             const auto& datn = (*m_data_n[ori])[lev];
             const auto& datnp1 = (*m_data_np1[ori])[lev];
             auto& dati = (*m_data_interp[ori])[lev];
-            dati.linInterp<amrex::RunOn::Device>(
-                datn, 0, datnp1, 0, m_tn, m_tnp1, m_tinterp, datn.box(), 0,
-                dati.nComp());
+            for (amrex::MFIter mfi(dati); mfi.isValid(); ++mfi) {
+                dati[mfi].linInterp<amrex::RunOn::Device>(
+                    datn[mfi], 0, datnp1[mfi], 0, m_tn, m_tnp1, m_tinterp,
+                    mfi.validbox(), 0, dati.nComp());
+            }
         }
     }
 }
@@ -281,6 +355,7 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     pp.queryarr("bndry_var_names", m_var_names);
     pp.get("bndry_file", m_filename);
     pp.query("bndry_output_format", m_out_fmt);
+    pp.query("bndry_prefetch_slices", m_in_data.num_prefetch());
 
 #ifndef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
@@ -315,6 +390,20 @@ void ABLBoundaryPlane::post_init_actions()
     read_file();
 }
 
+void ABLBoundaryPlane::post_regrid_actions()
+{
+    if (!m_is_initialized || (m_io_mode != io_mode::input)) {
+        return;
+    }
+
+    // The planes hold the boundary ghost cells of the boxes owned by each
+    // rank, so they are rebuilt and refilled at the last interpolation time
+    const amrex::Real time = m_in_data.tinterp();
+    m_in_data.reset();
+    read_header();
+    read_file(time);
+}
+
 void ABLBoundaryPlane::pre_advance_work()
 {
     if (!m_is_initialized) {
@@ -544,53 +633,46 @@ void ABLBoundaryPlane::write_file()
         amrex::Print() << "Writing abl boundary checkpoint file " << chkname
                        << " at time " << time << std::endl;
 
+        const int nlevels = m_repo.num_active_levels();
         const std::string level_prefix = "Level_";
-        amrex::PreBuildDirectorHierarchy(chkname, level_prefix, 1, true);
-
-        // for now only output level 0
-        const int lev = 0;
-
-        for (auto* fld : m_fields) {
+        amrex::PreBuildDirectorHierarchy(
+            chkname, level_prefix, nlevels, true);
 
-            auto& field = *fld;
-
-            const auto& geom = field.repo().mesh().Geom();
-
-            // note: by using the entire domain box we end up using 1 processor
-            // to hold all boundaries
-            amrex::Box domain = geom[lev].Domain();
-            amrex::BoxArray ba(domain);
-            amrex::DistributionMapping dm{ba};
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (auto* fld : m_fields) {
+                auto& field = *fld;
+                const int nc = field.num_comp();
 
-            amrex::BndryRegister bndry(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
+                std::string filename = amrex::MultiFabFileFullPrefix(
+                    lev, chkname, level_prefix, field.name());
 
-            bndry.copyFrom(
-                field(lev), 0, 0, 0, field.num_comp(), geom[lev].periodicity());
+                // print individual faces
+                for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+                    auto ori = oit();
+                    const std::string plane = m_plane_names[ori];
 
-            std::string filename = amrex::MultiFabFileFullPrefix(
-                lev, chkname, level_prefix, field.name());
+                    if (std::find(m_planes.begin(), m_planes.end(), plane) ==
+                        m_planes.end()) {
+                        continue;
+                    }
 
-            // print all boundaries and a header file
-            //            std::string header_file = chkname + "/header";
-            //            std::ofstream ofh(header_file, std::ios::out);
-            //            ofh << "time: " << time << '\n';
-            //            bndry.write(filename, ofh);
-            //            ofh.close();
+                    // The ghost and first interior cells of the boxes
+                    // touching the boundary stay on the ranks that own them
+                    amrex::BoxArray ba;
+                    amrex::DistributionMapping dm;
+                    if (!boundary_patches(lev, ori, true, ba, dm)) {
+                        continue;
+                    }
 
-            // print individual faces
-            for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
-                auto ori = oit();
-                const std::string plane = m_plane_names[ori];
+                    amrex::MultiFab bndry(ba, dm, nc, 0);
+                    bndry.ParallelCopy(
+                        field(lev), 0, 0, nc, amrex::IntVect(1),
+                        amrex::IntVect(0));
 
-                if (std::find(m_planes.begin(), m_planes.end(), plane) ==
-                    m_planes.end()) {
-                    continue;
+                    std::string facename =
+                        amrex::Concatenate(filename + '_', ori, 1);
+                    amrex::VisMF::Write(bndry, facename);
                 }
-
-                std::string facename =
-                    amrex::Concatenate(filename + '_', ori, 1);
-                bndry[ori].write(facename);
             }
         }
     }
@@ -605,6 +687,7 @@ void ABLBoundaryPlane::read_header()
 
     // FIXME: overallocate this for now
     m_in_data.resize(2 * AMREX_SPACEDIM);
+    m_in_nlevels = m_repo.num_active_levels();
 
 #ifdef AMR_WIND_USE_NETCDF
 
@@ -633,12 +716,8 @@ void ABLBoundaryPlane::read_header()
 
             m_in_data.define_plane(ori);
 
-            const int nlevels = plane_grp.num_groups();
-            // FIXME Do not support multi-level input mode yet.
-            // this is due to interpolation issues at the coarse-fine interface
-            if (nlevels > 1) {
-                amrex::Abort("Not supporting multi-level input mode yet.");
-            }
+            const int nlevels = std::min(
+                plane_grp.num_groups(), m_repo.num_active_levels());
             for (int lev = 0; lev < nlevels; ++lev) {
                 auto lev_grp = plane_grp.group(level_name(lev));
 
@@ -657,28 +736,34 @@ void ABLBoundaryPlane::read_header()
                     {minBox.length(perp[0]) * pdx[0],
                      minBox.length(perp[1]) * pdx[1]}};
 
+                // The extent of a fine level can change with a regrid
                 amrex::Vector<amrex::Real> nc_dat{{0, 0}};
+                amrex::Vector<amrex::Real> nc_lo{{0, 0}};
+                amrex::Vector<amrex::Real> nc_hi{{0, 0}};
                 lev_grp.var("lengths").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == lengths);
-                lev_grp.var("lo").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == los);
-                lev_grp.var("hi").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == his);
+                lev_grp.var("lo").get(nc_lo.data());
+                lev_grp.var("hi").get(nc_hi.data());
+                if ((nc_dat != lengths) || (nc_lo != los) || (nc_hi != his)) {
+                    amrex::Abort(
+                        "ABLBoundaryPlane: the extent of level " +
+                        std::to_string(lev) + " does not match the " +
+                        m_plane_names[ori] + " inflow plane in " + m_filename);
+                }
                 lev_grp.var("dx").get(nc_dat.data());
                 AMREX_ALWAYS_ASSERT(nc_dat == pdx);
 
                 // Create the data structures for the input data
-                amrex::IntVect plo(lo);
-                amrex::IntVect phi(hi);
-                plo[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
-                phi[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
-                const amrex::Box pbx(plo, phi);
+                amrex::BoxArray pba;
+                amrex::DistributionMapping pdm;
+                if (!boundary_patches(lev, ori, false, pba, pdm)) {
+                    break;
+                }
                 size_t nc = 0;
                 for (auto* fld : m_fields) {
                     m_in_data.component(fld->id()) = nc;
                     nc += fld->num_comp();
                 }
-                m_in_data.define_level_data(ori, pbx, nc);
+                m_in_data.define_level_data(ori, pba, pdm, nc);
             }
         }
 
@@ -737,8 +822,12 @@ void ABLBoundaryPlane::read_header()
             nc += fld->num_comp();
         }
 
-        // FIXME: need to generalize to lev > 0 somehow
-        const int lev = 0;
+        // Fine levels are only used when the first output in the file
+        // contains data for them
+        const std::string chkname =
+            m_filename + amrex::Concatenate("/bndry_output", m_in_timesteps[0]);
+        const std::string level_prefix = "Level_";
+        const int nlevels = m_repo.num_active_levels();
         for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
             auto ori = oit();
 
@@ -747,20 +836,30 @@ void ABLBoundaryPlane::read_header()
             // mass inflow from field bcs same for define level data below
             m_in_data.define_plane(ori);
 
-            const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
+            for (int lev = 0; lev < nlevels; ++lev) {
+                amrex::BoxArray pba;
+                amrex::DistributionMapping pdm;
+                if (!boundary_patches(lev, ori, false, pba, pdm)) {
+                    break;
+                }
 
-            amrex::IntVect plo(minBox.loVect());
-            amrex::IntVect phi(minBox.hiVect());
-            const int normal = ori.coordDir();
-            plo[normal] = ori.isHigh() ? minBox.hiVect()[normal] + 1 : -1;
-            phi[normal] = ori.isHigh() ? minBox.hiVect()[normal] + 1 : -1;
-            const amrex::Box pbx(plo, phi);
-            m_in_data.define_level_data(ori, pbx, nc);
+                const std::string facename = amrex::Concatenate(
+                    amrex::MultiFabFileFullPrefix(
+                        lev, chkname, level_prefix, m_fields[0]->name()) +
+                        '_',
+                    ori, 1);
+                if ((lev > 0) && !amrex::FileExists(facename + "_H")) {
+                    break;
+                }
+                m_in_data.define_level_data(ori, pba, pdm, nc);
+            }
         }
     }
 }
 
-void ABLBoundaryPlane::read_file()
+void ABLBoundaryPlane::read_file() { read_file(m_time.new_time()); }
+
+void ABLBoundaryPlane::read_file(const amrex::Real time)
 {
     BL_PROFILE("amr-wind::ABLBoundaryPlane::read_file");
     if (m_io_mode != io_mode::input) {
@@ -768,7 +867,6 @@ void ABLBoundaryPlane::read_file()
     }
 
     // populate planes and interpolate
-    const amrex::Real time = m_time.new_time();
     AMREX_ALWAYS_ASSERT((m_in_times[0] <= time) && (time < m_in_times.back()));
 
     // return early if current data files can still be interpolated in time
@@ -780,20 +878,48 @@ void ABLBoundaryPlane::read_file()
 #ifdef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
 
-        auto ncf = ncutils::NCFile::open_par(
-            m_filename, NC_NOWRITE | NC_NETCDF4 | NC_MPIIO,
-            amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
+        const int idx = closest_index(m_in_times, time);
+        const bool shifted = m_in_data.advance(idx, m_in_times);
+
+        // Only go to disk when the cache does not contain the slices needed
+        // for interpolation, reading ahead the next few slices
+        const int first = shifted ? idx + 1 : idx;
+        if (!m_in_data.is_cached(first, idx + 2)) {
+            const int nslices = std::min(
+                idx + 2 - first + m_in_data.num_prefetch(),
+                static_cast<int>(m_in_times.size()) - first);
+
+            auto ncf = ncutils::NCFile::open_par(
+                m_filename, NC_NOWRITE | NC_NETCDF4 | NC_MPIIO,
+                amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
+
+            for (amrex::OrientationIter oit; oit; ++oit) {
+                auto ori = oit();
+                if (!m_in_data.is_populated(ori)) continue;
+
+                const std::string plane = m_plane_names[ori];
+                const int nlevels = m_in_data.nlevels(ori);
+                for (auto* fld : m_fields) {
+                    for (int lev = 0; lev < nlevels; ++lev) {
+                        auto grp = ncf.group(plane).group(level_name(lev));
+                        const amrex::IntVect origin =
+                            m_mesh.boxArray(lev).minimalBox().smallEnd();
+                        m_in_data.read_data(
+                            grp, ori, lev, origin, fld, first, nslices);
+                    }
+                }
+            }
+            m_in_data.set_cache_range(first, first + nslices);
+        }
 
         for (amrex::OrientationIter oit; oit; ++oit) {
             auto ori = oit();
             if (!m_in_data.is_populated(ori)) continue;
 
-            const std::string plane = m_plane_names[ori];
-            const int nlevels = ncf.group(plane).num_groups();
+            const int nlevels = m_in_data.nlevels(ori);
             for (auto* fld : m_fields) {
                 for (int lev = 0; lev < nlevels; ++lev) {
-                    auto grp = ncf.group(plane).group(level_name(lev));
-                    m_in_data.read_data(grp, ori, lev, fld, time, m_in_times);
+                    m_in_data.fill_planes(ori, lev, fld, shifted);
                 }
             }
         }
@@ -817,47 +943,38 @@ void ABLBoundaryPlane::read_file()
 
         const std::string level_prefix = "Level_";
 
-        const int lev = 0;
-        for (auto* fld : m_fields) {
-
-            auto& field = *fld;
-            const auto& geom = field.repo().mesh().Geom();
-
-            amrex::Box domain = geom[lev].Domain();
-            amrex::BoxArray ba(domain);
-            amrex::DistributionMapping dm{ba};
-
-            amrex::BndryRegister bndry1(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
-            amrex::BndryRegister bndry2(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
-
-            bndry1.setVal(1.0e13);
-            bndry2.setVal(1.0e13);
-
-            std::string filename1 = amrex::MultiFabFileFullPrefix(
-                lev, chkname1, level_prefix, field.name());
-            std::string filename2 = amrex::MultiFabFileFullPrefix(
-                lev, chkname2, level_prefix, field.name());
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+            if (!m_in_data.is_populated(ori)) {
+                continue;
+            }
 
-            for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
-                auto ori = oit();
+            const int nlevels = m_in_data.nlevels(ori);
+            for (int lev = 0; lev < nlevels; ++lev) {
+                for (auto* fld : m_fields) {
+                    if (fld->bc_type()[ori] != BC::mass_inflow) {
+                        continue;
+                    }
 
-                if ((!m_in_data.is_populated(ori)) ||
-                    (field.bc_type()[ori] != BC::mass_inflow)) {
-                    continue;
+                    std::string filename1 = amrex::MultiFabFileFullPrefix(
+                        lev, chkname1, level_prefix, fld->name());
+                    std::string filename2 = amrex::MultiFabFileFullPrefix(
+                        lev, chkname2, level_prefix, fld->name());
+                    std::string facename1 =
+                        amrex::Concatenate(filename1 + '_', ori, 1);
+                    std::string facename2 =
+                        amrex::Concatenate(filename2 + '_', ori, 1);
+
+                    // Every rank reads the boxes assigned to it by VisMF,
+                    // these are redistributed onto the planes afterwards
+                    amrex::MultiFab bndry1;
+                    amrex::MultiFab bndry2;
+                    amrex::VisMF::Read(bndry1, facename1);
+                    amrex::VisMF::Read(bndry2, facename2);
+
+                    m_in_data.read_data_native(
+                        ori, bndry1, bndry2, lev, fld, time, m_in_times);
                 }
-
-                std::string facename1 =
-                    amrex::Concatenate(filename1 + '_', ori, 1);
-                std::string facename2 =
-                    amrex::Concatenate(filename2 + '_', ori, 1);
-
-                bndry1[ori].read(facename1);
-                bndry2[ori].read(facename2);
-
-                m_in_data.read_data_native(
-                    oit, bndry1, bndry2, lev, fld, time, m_in_times);
             }
         }
     }
@@ -890,50 +1007,29 @@ void ABLBoundaryPlane::populate_data(
             continue;
         }
 
-        // Ensure the fine level does not touch the inflow boundary
-        if (lev > 0) {
+        // Levels without inflow data must not touch the inflow boundary
+        if (lev >= m_in_data.nlevels(ori)) {
+            // A level created by a regrid is interpolated from the coarser
+            // level until the planes are redefined in post_regrid_actions
+            if (lev >= m_in_nlevels) {
+                continue;
+            }
             const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
             if (box_intersects_boundary(minBox, lev, ori)) {
                 amrex::Abort(
-                    "Fine level intersects inflow boundary, not supported "
-                    "yet.");
-            } else {
-                continue;
+                    "ABLBoundaryPlane: no inflow data for level " +
+                    std::to_string(lev) + " on boundary " +
+                    m_plane_names[ori] +
+                    ", the inflow file does not cover this level");
             }
+            continue;
         }
 
-        // Ensure inflow data exists at this level
-        if (lev >= m_in_data.nlevels(ori)) {
-            amrex::Abort("No inflow data at this level.");
-        }
-
-        // const int normal = ori.coordDir();
-        // const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
-
-        const size_t nc = mfab.nComp();
-
-#ifdef _OPENMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-        for (amrex::MFIter mfi(mfab, amrex::TilingIfNotGPU()); mfi.isValid();
-             ++mfi) {
-
-            const auto& sbx = mfi.growntilebox(1);
-            const auto& src = m_in_data.interpolate_data(ori, lev);
-            const auto& bx = sbx & src.box();
-            if (bx.isEmpty()) {
-                continue;
-            }
-
-            const auto& dest = mfab.array(mfi);
-            const auto& src_arr = src.array();
-            const int nstart = m_in_data.component(static_cast<int>(fld.id()));
-            amrex::ParallelFor(
-                bx, nc,
-                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                    dest(i, j, k, n) = src_arr(i, j, k, n + nstart);
-                });
-        }
+        const auto& src = m_in_data.interpolate_data(ori, lev);
+        const int nstart = m_in_data.component(static_cast<int>(fld.id()));
+        mfab.ParallelCopy(
+            src, nstart, 0, mfab.nComp(), amrex::IntVect(0),
+            amrex::IntVect(1));
     }
 
     const auto& geom = fld.repo().mesh().Geom();
@@ -965,6 +1061,9 @@ void ABLBoundaryPlane::write_data(
 
     AMREX_ALWAYS_ASSERT(dlo[0] == 0 && dlo[1] == 0 && dlo[2] == 0);
 
+    // Plane indices in the file are relative to the extents of the level
+    const amrex::IntVect mlo = m_mesh.boxArray(lev).minimalBox().smallEnd();
+
     grp.var(name).par_access(NC_COLLECTIVE);
 
     // FIXME optimization
@@ -1002,8 +1101,8 @@ void ABLBoundaryPlane::write_data(
             amrex::Gpu::streamSynchronize();
 
             buffer.start = {
-                m_out_counter, static_cast<size_t>(lo[perp[0]]),
-                static_cast<size_t>(lo[perp[1]]), 0};
+                m_out_counter, static_cast<size_t>(lo[perp[0]] - mlo[perp[0]]),
+                static_cast<size_t>(lo[perp[1]] - mlo[perp[1]]), 0};
             buffer.count = {1, n0, n1, nc};
         } else if (bhi[normal] == dhi[normal] && ori.isHigh()) {
             amrex::IntVect lo(blo);
@@ -1025,8 +1124,8 @@ void ABLBoundaryPlane::write_data(
             amrex::Gpu::streamSynchronize();
 
             buffer.start = {
-                m_out_counter, static_cast<size_t>(lo[perp[0]]),
-                static_cast<size_t>(lo[perp[1]]), 0};
+                m_out_counter, static_cast<size_t>(lo[perp[0]] - mlo[perp[0]]),
+                static_cast<size_t>(lo[perp[1]] - mlo[perp[1]]), 0};
             buffer.count = {1, n0, n1, nc};
         }
     }
@@ -1073,4 +1172,45 @@ bool ABLBoundaryPlane::box_intersects_boundary(
     return !intersection.isEmpty();
 }
 
+bool ABLBoundaryPlane::boundary_patches(
+    const int lev,
+    const amrex::Orientation ori,
+    const bool with_interior,
+    amrex::BoxArray& ba,
+    amrex::DistributionMapping& dm) const
+{
+    const amrex::Box& domain = m_mesh.Geom(lev).Domain();
+    const auto& mesh_ba = m_mesh.boxArray(lev);
+    const auto& mesh_dm = m_mesh.DistributionMap(lev);
+    const int normal = ori.coordDir();
+
+    amrex::BoxList bl;
+    amrex::Vector<int> pmap;
+    for (int i = 0; i < static_cast<int>(mesh_ba.size()); ++i) {
+        const amrex::Box& bx = mesh_ba[i];
+        if ((ori.isLow() && (bx.smallEnd(normal) != domain.smallEnd(normal))) ||
+            (ori.isHigh() && (bx.bigEnd(normal) != domain.bigEnd(normal)))) {
+            continue;
+        }
+
+        amrex::Box pbx = amrex::adjCell(bx, ori, 1);
+        if (with_interior) {
+            if (ori.isLow()) {
+                pbx.growHi(normal, 1);
+            } else {
+                pbx.growLo(normal, 1);
+            }
+        }
+        bl.push_back(pbx);
+        pmap.push_back(mesh_dm[i]);
+    }
+
+    if (bl.isEmpty()) {
+        return false;
+    }
+    ba = amrex::BoxArray(bl);
+    dm = amrex::DistributionMapping(pmap);
+    return true;
+}
+
 } // namespace amr_wind
@@ -2,6 +2,7 @@
 #include "amr-wind/wind_energy/actuator/ActuatorModel.H"
 #include "amr-wind/wind_energy/actuator/ActParser.H"
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
+#include "amr-wind/wind_energy/actuator/actuator_utils.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldRepo.H"
 
@@ -24,6 +25,7 @@ void Actuator::pre_init_actions()
 
     amrex::Vector<std::string> labels;
     pp.getarr("labels", labels);
+    pp.query("sparse_velocity_exchange", m_sparse_vel_exchange);
 
     const int nturbines = labels.size();
 
@@ -68,6 +70,7 @@ void Actuator::post_init_actions()
     }
 
     setup_container();
+    setup_box_actuators();
     update_positions();
     update_velocities();
     compute_forces();
@@ -82,6 +85,7 @@ void Actuator::post_regrid_actions()
     }
 
     setup_container();
+    setup_box_actuators();
 }
 
 void Actuator::pre_advance_work()
@@ -112,6 +116,18 @@ void Actuator::setup_container()
 
     m_container = std::make_unique<ActuatorContainer>(m_sim.mesh(), nlocal);
 
+    if (m_sparse_vel_exchange) {
+        // Ranks that share an actuator with this rank are the only ones that
+        // can sample velocities for the actuator points created here, or
+        // create points sampled here
+        amrex::Vector<const ActInfo*> infos;
+        for (const auto& act : m_actuators) {
+            infos.push_back(&act->info());
+        }
+        m_container->set_sparse_exchange(
+            true, utils::determine_peer_procs(infos));
+    }
+
     auto& pinfo = m_container->m_data;
     for (int i = 0, il = 0; i < ntotal; ++i) {
         if (m_actuators[i]->info().sample_vel_in_proc) {
@@ -124,6 +140,39 @@ void Actuator::setup_container()
     m_container->initialize_container();
 }
 
+/** Determine the (box, actuator) pairs that interact on each level
+ *
+ *  Only boxes that intersect the bounding box of an actuator component will
+ *  have source terms computed for that component. This method is invoked once
+ *  during initialization and after every regrid.
+ */
+void Actuator::setup_box_actuators()
+{
+    BL_PROFILE("amr-wind::actuator::Actuator::setup_box_actuators");
+    const int nlevels = m_sim.repo().num_active_levels();
+    m_box_actuators.resize(nlevels);
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& sfab = m_act_source(lev);
+        const auto& geom = m_sim.mesh().Geom(lev);
+        auto& blist = m_box_actuators[lev];
+        blist.clear();
+        blist.resize(sfab.local_size());
+
+        for (int ia = 0; ia < num_actuators(); ++ia) {
+            const auto& info = m_actuators[ia]->info();
+            if (!info.actuator_in_proc) continue;
+
+            const auto abx = utils::realbox_to_box(info.bound_box, geom);
+            for (amrex::MFIter mfi(sfab); mfi.isValid(); ++mfi) {
+                if (mfi.validbox().intersects(abx)) {
+                    blist[mfi.LocalIndex()].push_back(ia);
+                }
+            }
+        }
+    }
+}
+
 /** Update actuator positions and sample velocities at new locations.
  *
  *  This method loops over all the turbines local to this MPI rank and updates
@@ -188,15 +237,15 @@ void Actuator::compute_source_term()
     for (int lev = 0; lev < nlevels; ++lev) {
         auto& sfab = m_act_source(lev);
         const auto& geom = m_sim.mesh().Geom(lev);
+        const auto& blist = m_box_actuators[lev];
 
 #ifdef _OPENMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-        for (amrex::MFIter mfi(sfab); mfi.isValid(); ++mfi) {
-            for (auto& ac : m_actuators) {
-                if (ac->info().actuator_in_proc) {
-                    ac->compute_source_term(lev, mfi, geom);
-                }
+        for (amrex::MFIter mfi(sfab, amrex::TilingIfNotGPU()); mfi.isValid();
+             ++mfi) {
+            for (const int ia : blist[mfi.LocalIndex()]) {
+                m_actuators[ia]->compute_source_term(lev, mfi, geom);
             }
         }
     }
@@ -219,6 +219,11 @@ void ActuatorContainer::sample_velocities(const Field& vel)
  */
 void ActuatorContainer::populate_vel_buffer()
 {
+    if (m_sparse_exchange) {
+        populate_vel_buffer_sparse();
+        return;
+    }
+
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::populate_vel_buffer");
     amrex::Vector<vs::Vector> velh(m_proc_offsets.back());
     amrex::Gpu::DeviceVector<vs::Vector> vel(
@@ -261,6 +266,153 @@ void ActuatorContainer::populate_vel_buffer()
     }
 }
 
+/** Helper method for ActuatorContainer::sample_velocities
+ *
+ *  Sparse alternative to the global reduction in populate_vel_buffer. The
+ *  sampled velocities are sent only to the MPI rank that created the
+ *  corresponding particle. As actuator points lie within the bounding box of
+ *  their actuator, the rank that samples a point is always one of the
+ *  influenced processes of that actuator, and the communication is restricted
+ *  to those peer ranks.
+ */
+void ActuatorContainer::populate_vel_buffer_sparse()
+{
+    BL_PROFILE(
+        "amr-wind::actuator::ActuatorContainer::populate_vel_buffer_sparse");
+
+    // Pack the sampled data from all particle tiles into contiguous arrays
+    const int nlevels = m_mesh.finestLevel() + 1;
+    int np_total = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            np_total += pti.numParticles();
+        }
+    }
+
+    amrex::Gpu::DeviceVector<int> dest_d(np_total);
+    amrex::Gpu::DeviceVector<int> idx_d(np_total);
+    amrex::Gpu::DeviceVector<vs::Vector> vel_d(np_total);
+    {
+        auto* dest = dest_d.data();
+        auto* pidx = idx_d.data();
+        auto* varr = vel_d.data();
+        int offset = 0;
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+                const int np = pti.numParticles();
+                auto* pstruct = pti.GetArrayOfStructs()().data();
+
+                amrex::ParallelFor(
+                    np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                        auto& pp = pstruct[ip];
+                        dest[offset + ip] = pp.cpu();
+                        pidx[offset + ip] = pp.idata(0);
+                        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                            varr[offset + ip][n] = pp.rdata(n);
+                        }
+                    });
+                offset += np;
+            }
+        }
+    }
+
+    amrex::Vector<int> dest_h(np_total);
+    amrex::Vector<int> idx_h(np_total);
+    amrex::Vector<vs::Vector> vel_h(np_total);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, dest_d.begin(), dest_d.end(),
+        dest_h.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, idx_d.begin(), idx_d.end(), idx_h.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, vel_d.begin(), vel_d.end(), vel_h.begin());
+
+    auto& vel_arr = m_data.velocity;
+    std::fill(vel_arr.begin(), vel_arr.end(), vs::Vector::zero());
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const int npeers = m_peer_procs.size();
+
+    // Message layout per point: local index followed by velocity components
+    constexpr int nrec = AMREX_SPACEDIM + 1;
+    amrex::Vector<amrex::Vector<amrex::Real>> send_buf(npeers);
+    for (int i = 0; i < np_total; ++i) {
+        if (dest_h[i] == iproc) {
+            vel_arr[idx_h[i]] = vel_h[i];
+            continue;
+        }
+
+        const auto it = std::lower_bound(
+            m_peer_procs.begin(), m_peer_procs.end(), dest_h[i]);
+        if ((it == m_peer_procs.end()) || (*it != dest_h[i])) {
+            amrex::Abort(
+                "ActuatorContainer: actuator point sampled outside the "
+                "influenced processes of its actuator. Disable "
+                "Actuator.sparse_velocity_exchange for this case.");
+        }
+        auto& buf = send_buf[std::distance(m_peer_procs.begin(), it)];
+        buf.push_back(static_cast<amrex::Real>(idx_h[i]));
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            buf.push_back(vel_h[i][n]);
+        }
+    }
+
+#ifdef AMREX_USE_MPI
+    // Every rank reserves the message tags, so that the AMReX sequence
+    // numbers stay consistent across ranks with and without peers
+    const int count_tag = amrex::ParallelDescriptor::SeqNum();
+    const int vel_tag = amrex::ParallelDescriptor::SeqNum();
+    if (npeers < 1) return;
+
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    amrex::Vector<MPI_Request> requests(2 * npeers);
+
+    // Exchange message sizes with all peers
+    amrex::Vector<int> send_count(npeers), recv_count(npeers);
+    for (int ip = 0; ip < npeers; ++ip) {
+        send_count[ip] = send_buf[ip].size();
+        MPI_Irecv(
+            &recv_count[ip], 1, MPI_INT, m_peer_procs[ip], count_tag, comm,
+            &requests[ip]);
+    }
+    for (int ip = 0; ip < npeers; ++ip) {
+        MPI_Isend(
+            &send_count[ip], 1, MPI_INT, m_peer_procs[ip], count_tag, comm,
+            &requests[npeers + ip]);
+    }
+    MPI_Waitall(2 * npeers, requests.data(), MPI_STATUSES_IGNORE);
+
+    // Exchange the sampled velocities
+    amrex::Vector<amrex::Vector<amrex::Real>> recv_buf(npeers);
+    for (int ip = 0; ip < npeers; ++ip) {
+        recv_buf[ip].resize(recv_count[ip]);
+        MPI_Irecv(
+            recv_buf[ip].data(), recv_count[ip],
+            amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type(),
+            m_peer_procs[ip], vel_tag, comm, &requests[ip]);
+    }
+    for (int ip = 0; ip < npeers; ++ip) {
+        MPI_Isend(
+            send_buf[ip].data(), send_count[ip],
+            amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type(),
+            m_peer_procs[ip], vel_tag, comm, &requests[npeers + ip]);
+    }
+    MPI_Waitall(2 * npeers, requests.data(), MPI_STATUSES_IGNORE);
+
+    for (const auto& buf : recv_buf) {
+        const int nrecv = buf.size() / nrec;
+        for (int i = 0; i < nrecv; ++i) {
+            const int idx = static_cast<int>(buf[i * nrec]);
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                vel_arr[idx][n] = buf[i * nrec + 1 + n];
+            }
+        }
+    }
+#else
+    amrex::ignore_unused(nrec);
+#endif
+}
+
 /** Helper method for ActuatorContainer::sample_velocities
  *
  *  Performs a trilinear interpolation of the velocity field to particle
@@ -5,15 +5,6 @@ namespace amr_wind {
 namespace actuator {
 namespace utils {
 
-namespace {
-
-/** Convert a bounding box into amrex::Box index space at a given level
- *
- *  \param rbx Bounding box as defined in global domain coordinates
- *  \param geom AMReX geometry information for a given level
- *  \return The Box instance that defines the index space equivalent to bounding
- * boxt
- */
 amrex::Box
 realbox_to_box(const amrex::RealBox& rbx, const amrex::Geometry& geom)
 {
@@ -36,8 +27,6 @@ realbox_to_box(const amrex::RealBox& rbx, const amrex::Geometry& geom)
     return amrex::Box{lo, hi};
 }
 
-} // namespace
-
 std::set<int> determine_influenced_procs(
     const amrex::AmrCore& mesh, const amrex::RealBox& rbx)
 {
@@ -66,6 +55,19 @@ std::set<int> determine_influenced_procs(
     return procs;
 }
 
+amrex::Vector<int>
+determine_peer_procs(const amrex::Vector<const ActInfo*>& infos)
+{
+    std::set<int> peers;
+    for (const auto* info : infos) {
+        if (info->actuator_in_proc) {
+            peers.insert(info->procs.begin(), info->procs.end());
+        }
+    }
+    peers.erase(amrex::ParallelDescriptor::MyProc());
+    return amrex::Vector<int>(peers.begin(), peers.end());
+}
+
 void determine_root_proc(ActInfo& info, amrex::Vector<int>& act_proc_count)
 {
     auto& plist = info.procs;
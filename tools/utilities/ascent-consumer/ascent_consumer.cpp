@@ -0,0 +1,198 @@
+/** Stand-in in-situ consumer for the AMR-Wind Ascent staging mode
+ *
+ *  Listens on a Unix domain socket for Blueprint meshes sent by the
+ *  `ascent.staging_socket` option of AMR-Wind. Once the meshes from all ranks
+ *  for a given cycle have arrived, the domains are merged and either rendered
+ *  with a serial Ascent instance (when an actions file is provided) or verified
+ *  and summarized. The Ascent instance is opened when the first cycle is
+ *  complete, using the ghost indicator field names sent along with the mesh.
+ *
+ *  Usage: amr_wind_ascent_consumer <socket_path> [ascent_actions.yaml]
+ */
+
+#include "amr-wind/utilities/ascent/BlueprintStager.H"
+
+#include <ascent.hpp>
+#include <conduit.hpp>
+#include <conduit_blueprint.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+using amr_wind::ascent_int::StagingHeader;
+
+bool recv_bytes(int fd, void* buf, std::size_t nbytes)
+{
+    auto* ptr = static_cast<char*>(buf);
+    while (nbytes > 0) {
+        const auto nrecv = ::recv(fd, ptr, nbytes, 0);
+        if (nrecv < 0 && errno == EINTR) continue;
+        if (nrecv <= 0) return false;
+        ptr += nrecv;
+        nbytes -= static_cast<std::size_t>(nrecv);
+    }
+    return true;
+}
+
+struct CycleData
+{
+    conduit::Node mesh;
+    std::size_t num_received{0};
+    std::size_t num_expected{0};
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <socket_path> [ascent_actions_file]" << std::endl;
+        return 1;
+    }
+
+    const std::string socket_path(argv[1]);
+    conduit::Node actions;
+    const bool render = (argc > 2);
+    if (render) {
+        const std::string actions_file(argv[2]);
+        const bool is_json = (actions_file.size() > 5) &&
+                             (actions_file.substr(actions_file.size() - 5) ==
+                              ".json");
+        actions.load(actions_file, is_json ? "json" : "yaml");
+    }
+
+    sockaddr_un addr{};
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "Socket path too long: " << socket_path << std::endl;
+        return 1;
+    }
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    const int lsock = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ::unlink(socket_path.c_str());
+    if ((lsock < 0) ||
+        (::bind(lsock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) !=
+         0) ||
+        (::listen(lsock, SOMAXCONN) != 0)) {
+        std::cerr << "Cannot listen on " << socket_path << ": "
+                  << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    std::cout << "Waiting for AMR-Wind on " << socket_path << std::endl;
+
+    ascent::Ascent ascent;
+    bool ascent_open = false;
+    std::vector<std::string> ghost_fields;
+
+    std::vector<pollfd> fds{{lsock, POLLIN, 0}};
+    std::map<std::uint64_t, CycleData> cycles;
+    bool had_clients = false;
+
+    // Run until all solver ranks have connected and disconnected again
+    while (!had_clients || fds.size() > 1) {
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        if ((fds[0].revents & POLLIN) != 0) {
+            const int csock = ::accept(lsock, nullptr, nullptr);
+            if (csock >= 0) {
+                fds.push_back({csock, POLLIN, 0});
+                had_clients = true;
+            }
+        }
+
+        for (std::size_t i = fds.size() - 1; i > 0; --i) {
+            if ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0) continue;
+
+            StagingHeader header;
+            std::string schema;
+            std::string ghosts;
+            std::vector<char> data;
+            bool ok = recv_bytes(fds[i].fd, &header, sizeof(header)) &&
+                      (header.magic == StagingHeader::magic_number);
+            if (ok) {
+                schema.resize(header.schema_bytes);
+                ghosts.resize(header.ghost_bytes);
+                data.resize(header.data_bytes);
+                ok = recv_bytes(fds[i].fd, &schema[0], schema.size()) &&
+                     recv_bytes(fds[i].fd, &ghosts[0], ghosts.size()) &&
+                     recv_bytes(fds[i].fd, data.data(), data.size());
+            }
+            if (!ok) {
+                ::close(fds[i].fd);
+                fds.erase(fds.begin() + static_cast<long>(i));
+                continue;
+            }
+
+            if (!ascent_open && ghost_fields.empty()) {
+                std::istringstream gstream(ghosts);
+                std::string gname;
+                while (std::getline(gstream, gname)) {
+                    if (!gname.empty()) ghost_fields.push_back(gname);
+                }
+            }
+
+            conduit::Node rank_mesh;
+            conduit::Generator(schema, "conduit_json", data.data())
+                .walk(rank_mesh);
+
+            auto& cdata = cycles[header.cycle];
+            cdata.num_expected = header.num_ranks;
+            ++cdata.num_received;
+            for (conduit::index_t d = 0; d < rank_mesh.number_of_children();
+                 ++d) {
+                const auto& dom = rank_mesh.child(d);
+                cdata.mesh[dom.name()].set(dom);
+            }
+
+            if (cdata.num_received < cdata.num_expected) continue;
+
+            conduit::Node info;
+            const bool valid =
+                conduit::blueprint::mesh::verify(cdata.mesh, info);
+            std::cout << "Cycle " << header.cycle << ": "
+                      << cdata.mesh.number_of_children() << " domains, "
+                      << cdata.mesh.total_bytes_compact() << " bytes, "
+                      << (valid ? "valid" : "invalid") << " blueprint"
+                      << std::endl;
+            if (render && valid) {
+                if (!ascent_open) {
+                    // Ghost cells must be known to Ascent at open time
+                    conduit::Node open_opts;
+                    open_opts["actions_file"] = "";
+                    for (const auto& gname : ghost_fields) {
+                        open_opts["ghost_field_name"].append() = gname;
+                    }
+                    ascent.open(open_opts);
+                    ascent_open = true;
+                }
+                ascent.publish(cdata.mesh);
+                ascent.execute(actions);
+            }
+            cycles.erase(header.cycle);
+        }
+    }
+
+    if (ascent_open) {
+        ascent.close();
+    }
+    ::close(lsock);
+    ::unlink(socket_path.c_str());
+    return 0;
+}
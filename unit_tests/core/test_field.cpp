@@ -170,6 +170,38 @@ TEST_F(FieldRepoTest, field_multiple_states)
     }
 }
 
+TEST_F(FieldRepoTest, field_version)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& velocity = frepo.declare_field("vel", 3, 0, 2);
+    auto& vel_old = velocity.state(amr_wind::FieldState::Old);
+
+    const auto vnew = velocity.version();
+    const auto vold = vel_old.version();
+
+    velocity.setVal(1.0);
+    EXPECT_GT(velocity.version(), vnew);
+    EXPECT_EQ(vel_old.version(), vold);
+
+    // Advancing states carries the version along with the data
+    const auto vnew1 = velocity.version();
+    velocity.advance_states();
+    EXPECT_EQ(velocity.version(), vnew1);
+    EXPECT_EQ(vel_old.version(), vnew1);
+    EXPECT_NE(vel_old.version(), vold);
+
+    // Data that does not change keeps its version across steps
+    velocity.advance_states();
+    EXPECT_EQ(velocity.version(), vnew1);
+    EXPECT_EQ(vel_old.version(), vnew1);
+
+    const auto vnew2 = velocity.version();
+    velocity.mark_modified();
+    EXPECT_GT(velocity.version(), vnew2);
+}
+
 TEST_F(FieldRepoTest, field_location)
 {
     initialize_mesh();
@@ -236,6 +268,39 @@ TEST_F(FieldRepoTest, field_advance_states)
     }
 }
 
+TEST_F(FieldRepoTest, field_rotate_states)
+{
+    initialize_mesh();
+
+    auto& field_repo = mesh().field_repo();
+    auto& scalar = field_repo.declare_field("scal", 1, 0, 3);
+    auto& scal_old = scalar.state(amr_wind::FieldState::Old);
+    auto& scal_nm1 = scalar.state(amr_wind::FieldState::NM1);
+
+    // Level data is exchanged in place, references remain valid
+    const auto* new_mf = &scalar(0);
+    const auto* old_mf = &scal_old(0);
+
+    scalar.setVal(1.0);
+    scal_old.setVal(2.0);
+    scal_nm1.setVal(3.0);
+    scalar.advance_states();
+
+    EXPECT_EQ(&scalar(0), new_mf);
+    EXPECT_EQ(&scal_old(0), old_mf);
+    EXPECT_NEAR(scalar(0).min(0), 1.0, 1.0e-12);
+    EXPECT_NEAR(scal_old(0).min(0), 1.0, 1.0e-12);
+    EXPECT_NEAR(scal_nm1(0).min(0), 2.0, 1.0e-12);
+
+    // Without the copy, New holds the data of the oldest state
+    scalar.copy_on_advance() = false;
+    scalar.setVal(4.0);
+    scalar.advance_states();
+    EXPECT_NEAR(scalar(0).max(0), 2.0, 1.0e-12);
+    EXPECT_NEAR(scal_old(0).max(0), 4.0, 1.0e-12);
+    EXPECT_NEAR(scal_nm1(0).max(0), 1.0, 1.0e-12);
+}
+
 TEST_F(FieldRepoTest, field_create_state)
 {
     initialize_mesh();
@@ -312,6 +377,80 @@ TEST_F(FieldRepoTest, scratch_fields)
     }
 }
 
+TEST_F(FieldRepoTest, scratch_field_pool)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    const auto data_ptr = [](const amr_wind::ScratchField& fld) {
+        const amrex::Real* ptr = nullptr;
+        for (amrex::MFIter mfi(fld(0)); mfi.isValid(); ++mfi) {
+            ptr = fld(0)[mfi].dataPtr();
+            break;
+        }
+        return ptr;
+    };
+
+    const amrex::Real* grad_ptr = nullptr;
+    {
+        auto grad = frepo.create_scratch_field(3, 1);
+        grad_ptr = data_ptr(*grad);
+    }
+    EXPECT_EQ(frepo.scratch_stats().num_pooled, 1);
+
+    // Requests with a different layout do not use the released data
+    auto divu = frepo.create_scratch_field(1, 1);
+    auto flux = frepo.create_scratch_field(3, 1, amr_wind::FieldLoc::XFACE);
+    EXPECT_EQ(frepo.scratch_stats().num_reused, 0);
+
+    auto gradp = frepo.create_scratch_field("gradp", 3, 1);
+    EXPECT_EQ(data_ptr(*gradp), grad_ptr);
+    EXPECT_EQ(gradp->num_comp(), 3);
+    EXPECT_EQ(gradp->name(), "gradp");
+    EXPECT_EQ(frepo.scratch_stats().num_requests, 4);
+    EXPECT_EQ(frepo.scratch_stats().num_reused, 1);
+    EXPECT_EQ(frepo.scratch_stats().num_pooled, 0);
+
+    frepo.use_scratch_pool() = false;
+    gradp.reset();
+    EXPECT_EQ(frepo.scratch_stats().num_pooled, 0);
+    EXPECT_EQ(frepo.scratch_stats().pooled_bytes, 0);
+}
+
+TEST_F(FieldRepoTest, scratch_field_pool_limits)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    const auto& stats = frepo.scratch_stats();
+
+    // Data not reused within the next step is freed
+    frepo.create_scratch_field(3, 1).reset();
+    const auto nbytes = stats.pooled_bytes;
+    EXPECT_GT(nbytes, 0);
+    frepo.trim_scratch_pool();
+    EXPECT_EQ(stats.num_pooled, 1);
+    frepo.trim_scratch_pool();
+    EXPECT_EQ(stats.num_pooled, 0);
+    EXPECT_EQ(stats.pooled_bytes, 0);
+    EXPECT_EQ(stats.num_discarded, 1);
+
+    // Only the most recently released field fits within the cap
+    frepo.scratch_pool_max_bytes() = nbytes;
+    {
+        auto grad = frepo.create_scratch_field(3, 1);
+        auto flux = frepo.create_scratch_field(3, 1);
+    }
+    EXPECT_EQ(stats.num_pooled, 1);
+    EXPECT_EQ(stats.pooled_bytes, nbytes);
+    EXPECT_EQ(stats.num_discarded, 2);
+
+    frepo.scratch_pool_max_bytes() = nbytes - 1;
+    frepo.create_scratch_field(3, 1).reset();
+    EXPECT_EQ(stats.num_pooled, 0);
+    EXPECT_EQ(stats.pooled_bytes, 0);
+}
+
 TEST_F(FieldRepoTest, int_fields)
 {
     initialize_mesh();
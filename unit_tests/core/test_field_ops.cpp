@@ -3,6 +3,28 @@
 
 namespace amr_wind_tests {
 
+//! Mesh that refines a single box that can be moved between regrids
+class MovingBoxMesh : public AmrTestMesh
+{
+public:
+    amrex::Box& refine_box() { return m_refine_box; }
+
+protected:
+    void ErrorEst(
+        int lev,
+        amrex::TagBoxArray& tags,
+        amrex::Real /*time*/,
+        int /*ngrow*/) override
+    {
+        if (lev == 0) {
+            tags.setVal(amrex::BoxArray(m_refine_box), amrex::TagBox::SET);
+        }
+    }
+
+private:
+    amrex::Box m_refine_box;
+};
+
 class FieldOpsTest : public MeshTest
 {
 public:
@@ -52,4 +74,71 @@ TEST_F(FieldOpsTest, compute_max_magnitude)
     EXPECT_NEAR(global_maximum, 21.5, 1.0e-12);
 }
 
+TEST_F(FieldOpsTest, masked_level_sum)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& field = frepo.declare_field("scalar_field", 1, 0, 1);
+    const auto& geom = mesh().Geom();
+    initialise_default_fields(field, geom, 1);
+
+    // The mask is cached until the next regrid
+    const auto& mask = frepo.level_mask(0);
+    EXPECT_EQ(&mask, &frepo.level_mask(0));
+    EXPECT_EQ(mask.min(0), 1);
+
+    const auto& farrs = field(0).const_arrays();
+    const auto sums = amr_wind::field_ops::masked_level_sum<3>(
+        frepo, 0,
+        [=] AMREX_GPU_HOST_DEVICE(
+            int nbx, int i, int j, int k,
+            amrex::GpuArray<amrex::Real, 3>& qty) noexcept {
+            const amrex::Real val = farrs[nbx](i, j, k);
+            qty[0] = 1.0;
+            qty[1] = val;
+            qty[2] = val * val;
+        });
+
+    auto gsums = sums;
+    amrex::ParallelAllReduce::Sum(
+        gsums.data(), 3, amrex::ParallelContext::CommunicatorSub());
+
+    const amrex::Real tol = 1.0e-10;
+    const amrex::Real fsum = field(0).sum(0);
+    const amrex::Real fdot =
+        amrex::MultiFab::Dot(field(0), 0, field(0), 0, 1, 0);
+    EXPECT_NEAR(gsums[0], geom[0].Domain().numPts(), tol);
+    EXPECT_NEAR(gsums[1], fsum, tol * std::abs(fsum));
+    EXPECT_NEAR(gsums[2], fdot, tol * fdot);
+}
+
+TEST_F(FieldOpsTest, level_mask_fine_regrid)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_level", 1);
+        pp.add("blocking_factor", 2);
+        pp.add("n_error_buf", 0);
+        pp.add("grid_eff", 1.0);
+    }
+
+    create_mesh_instance<MovingBoxMesh>();
+    auto* amesh = mesh<MovingBoxMesh>();
+    amesh->refine_box() = amrex::Box({0, 0, 0}, {1, 1, 1});
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    const auto ncells = mesh().Geom(0).Domain().numPts();
+    EXPECT_EQ(frepo.level_mask(0).sum(0), ncells - 8);
+
+    // Only the finer level changes, but the mask of the coarser level must be
+    // recomputed since it depends on the finer grids
+    const amrex::BoxArray ba0 = mesh().boxArray(0);
+    amesh->refine_box() = amrex::Box({4, 4, 4}, {7, 7, 7});
+    mesh().regrid(0, 0.0);
+    EXPECT_TRUE(mesh().boxArray(0) == ba0);
+    EXPECT_EQ(frepo.level_mask(0).sum(0), ncells - 64);
+}
+
 } // namespace amr_wind_tests
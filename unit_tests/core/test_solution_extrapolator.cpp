@@ -0,0 +1,63 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/SolutionExtrapolator.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void fill_solution(amr_wind::Field& field, const amrex::Real time)
+{
+    for (int lev = 0; lev < field.repo().num_active_levels(); ++lev) {
+        for (amrex::MFIter mfi(field(lev)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& farr = field(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    farr(i, j, k) = (1.0 + i + j + k) * (2.0 + 3.0 * time);
+                });
+        }
+    }
+}
+
+} // namespace
+
+class SolutionExtrapolatorTest : public MeshTest
+{};
+
+TEST_F(SolutionExtrapolatorTest, linear_extrapolation)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& sol = frepo.declare_field("sol", 1, 0);
+    auto& guess = frepo.declare_field("guess", 1, 0);
+    auto& expected = frepo.declare_field("expected", 1, 0);
+
+    amr_wind::SolutionExtrapolator extrap;
+    EXPECT_FALSE(extrap.extrapolate(guess.vec_ptrs(), 1.0));
+
+    // A single solution is used as is
+    fill_solution(sol, 0.5);
+    extrap.store(sol.vec_const_ptrs(), 0.5);
+    EXPECT_EQ(extrap.num_stored(), 1);
+    EXPECT_TRUE(extrap.extrapolate(guess.vec_ptrs(), 1.0));
+    amrex::MultiFab::Subtract(guess(0), sol(0), 0, 0, 1, 0);
+    EXPECT_NEAR(guess(0).norm0(), 0.0, 1.0e-12);
+
+    // Solutions at the same time replace the latest entry
+    fill_solution(sol, 100.0);
+    extrap.store(sol.vec_const_ptrs(), 1.0);
+    fill_solution(sol, 1.0);
+    extrap.store(sol.vec_const_ptrs(), 1.0);
+    EXPECT_EQ(extrap.num_stored(), 2);
+
+    // Linear in time solutions are extrapolated exactly
+    EXPECT_TRUE(extrap.extrapolate(guess.vec_ptrs(), 1.75));
+    fill_solution(expected, 1.75);
+    amrex::MultiFab::Subtract(guess(0), expected(0), 0, 0, 1, 0);
+    EXPECT_NEAR(guess(0).norm0(), 0.0, 1.0e-10 * expected(0).norm0());
+
+    extrap.reset();
+    EXPECT_FALSE(extrap.extrapolate(guess.vec_ptrs(), 2.0));
+}
+
+} // namespace amr_wind_tests
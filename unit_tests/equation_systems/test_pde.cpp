@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "aw_test_utils/MeshTest.H"
+#include "amr-wind/equation_systems/PDEBase.H"
 
 namespace amr_wind_tests {
 
@@ -21,6 +22,10 @@ TEST_F(PDETest, test_pde_create_godunov)
     EXPECT_EQ(pde_mgr.scalar_eqns().size(), 1);
 
     EXPECT_EQ(mesh().field_repo().num_fields(), 21);
+
+    // Temperature New is overwritten by the predictor and is not restored
+    EXPECT_TRUE(pde_mgr.icns().fields().field.copy_on_advance());
+    EXPECT_FALSE(pde_mgr.scalar_eqns()[0]->fields().field.copy_on_advance());
 }
 
 TEST_F(PDETest, test_pde_create_mol)
@@ -40,4 +45,45 @@ TEST_F(PDETest, test_pde_create_mol)
     EXPECT_EQ(mesh().field_repo().num_fields(), 25);
 }
 
+TEST_F(PDETest, test_pde_diffusion_coeffs_unchanged)
+{
+    amrex::ParmParse pp("incflo");
+    pp.add("probtype", 0);
+    pp.add("use_godunov", 1);
+
+    initialize_mesh();
+
+    auto& sim = mesh().sim();
+    sim.create_turbulence_model();
+    auto& pde_mgr = sim.pde_manager();
+    auto& icns = pde_mgr.register_icns();
+    icns.initialize();
+
+    auto& density = mesh().field_repo().get_field("density");
+    auto& mueff = icns.fields().mueff;
+    density.setVal(1.0);
+    density.state(amr_wind::FieldState::Old).setVal(1.0);
+    icns.compute_mueff(amr_wind::FieldState::Old);
+    icns.compute_mueff(amr_wind::FieldState::New);
+
+    // The diffusion operator only pushes coefficients when the versions of
+    // the density and viscosity differ from those of the previous solve
+    const auto vrho = density.version();
+    const auto vmu = mueff.version();
+    for (int step = 0; step < 2; ++step) {
+        pde_mgr.advance_states();
+        icns.compute_mueff(amr_wind::FieldState::Old);
+        icns.compute_mueff(amr_wind::FieldState::New);
+
+        EXPECT_EQ(density.version(), vrho);
+        EXPECT_EQ(mueff.version(), vmu);
+    }
+
+    // Modifying the viscosity field, e.g., during a regrid, forces an update
+    mueff.mark_modified();
+    const auto vmu1 = mueff.version();
+    icns.compute_mueff(amr_wind::FieldState::New);
+    EXPECT_NE(mueff.version(), vmu1);
+}
+
 } // namespace amr_wind_tests
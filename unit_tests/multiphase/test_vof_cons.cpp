@@ -83,10 +83,13 @@ check_accuracy(int dir, int nx, amrex::Real tol, amr_wind::Field& vof)
     run_algorithm(vof, [&](const int lev, const amrex::MFIter& mfi) {
         const auto& vof_arr = vof(lev).const_array(mfi);
 
+        const auto lo = amrex::lbound(mfi.validbox());
+        const auto hi = amrex::ubound(mfi.validbox());
+
         // Loop manually through cells to check values
-        for (int i = 0; i < nx; ++i) {
-            for (int j = 0; j < nx; ++j) {
-                for (int k = 0; k < nx; ++k) {
+        for (int i = lo.x; i <= hi.x; ++i) {
+            for (int j = lo.y; j <= hi.y; ++j) {
+                for (int k = lo.z; k <= hi.z; ++k) {
 
                     int icheck = 0;
                     switch (dir) {
@@ -128,7 +131,7 @@ protected:
             amrex::ParmParse pp("amr");
             amrex::Vector<int> ncell{{m_nx, m_nx, m_nx}};
             pp.add("max_level", 0);
-            pp.add("max_grid_size", m_nx);
+            pp.add("max_grid_size", m_max_grid_size);
             pp.addarr("n_cell", ncell);
         }
         {
@@ -157,12 +160,13 @@ protected:
         {
             amrex::ParmParse pp("VOF");
             pp.add("remove_debris", 0);
+            pp.add("narrow_band", static_cast<int>(m_narrow_band));
         }
     }
 
     void testing_coorddir(const int dir, amrex::Real CFL)
     {
-        constexpr double tol = 1.0e-15;
+        const amrex::Real tol = m_tol;
 
         // Flow-through time
         const amrex::Real ft_time = 1.0 / m_vel;
@@ -216,7 +220,7 @@ protected:
         initialize_adv_velocities(vof, umac, vmac, wmac, varr);
 
         // Get initial VOF sum
-        amrex::Real sum_vof0 = mphase.volume_fraction_sum();
+        amrex::Real sum_vof0 = mphase.volume_momentum_sums()[0];
         // Get equation handle and perform init
         auto& seqn = pde_mgr(
             amr_wind::pde::VOF::pde_name() + "-" +
@@ -228,7 +232,7 @@ protected:
             seqn.compute_advection_term(amr_wind::FieldState::Old);
             seqn.post_solve_actions();
             // Check conservation
-            EXPECT_NEAR(mphase.volume_fraction_sum(), sum_vof0, tol);
+            EXPECT_NEAR(mphase.volume_momentum_sums()[0], sum_vof0, tol);
         }
 
         if (dir >= 0) {
@@ -238,7 +242,10 @@ protected:
     const amrex::Real m_rho1 = 1000.0;
     const amrex::Real m_rho2 = 1.0;
     const amrex::Real m_vel = 5.0;
-    const int m_nx = 3;
+    int m_nx = 3;
+    int m_max_grid_size = 3;
+    bool m_narrow_band{false};
+    amrex::Real m_tol = 1.0e-15;
     amrex::Real dt = 0.0; // will be set according to CFL
 };
 
@@ -249,5 +256,15 @@ TEST_F(VOFConsTest, Z) { testing_coorddir(2, 0.45); }
 // during directionally-split advection
 TEST_F(VOFConsTest, CFL045) { testing_coorddir(-1, 0.45); }
 TEST_F(VOFConsTest, CFL01) { testing_coorddir(-1, 0.1); }
+// Boxes far from the interface are skipped and become active as it moves
+TEST_F(VOFConsTest, narrow_band)
+{
+    m_nx = 24;
+    m_max_grid_size = 4;
+    m_narrow_band = true;
+    // Round-off accumulated in the sum over a larger mesh
+    m_tol = 1.0e-12;
+    testing_coorddir(0, 0.45);
+}
 
 } // namespace amr_wind_tests
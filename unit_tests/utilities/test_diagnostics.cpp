@@ -0,0 +1,112 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/utilities/diagnostics.H"
+
+#include <limits>
+
+namespace amr_wind_tests {
+
+class DiagnosticsTest : public MeshTest
+{};
+
+TEST_F(DiagnosticsTest, compute_stats)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& vel = frepo.declare_field("vel", 3, 0);
+    auto& scal = frepo.declare_field("scal", 1, 0);
+
+    vel.setVal(amrex::Vector<amrex::Real>{-2.0, 1.0, 3.0});
+    scal.setVal(0.5);
+
+    // Place a NaN and an extreme value in the first cell of every box
+    const amrex::Real qnan = std::numeric_limits<amrex::Real>::quiet_NaN();
+    for (amrex::MFIter mfi(scal(0)); mfi.isValid(); ++mfi) {
+        const auto& sarr = scal(0).array(mfi);
+        const auto& varr = vel(0).array(mfi);
+        const auto lo = amrex::lbound(mfi.validbox());
+        amrex::ParallelFor(1, [=] AMREX_GPU_DEVICE(int) noexcept {
+            sarr(lo.x, lo.y, lo.z) = qnan;
+            varr(lo.x, lo.y, lo.z, 1) = -5.0;
+        });
+    }
+
+    const auto stats =
+        amr_wind::diagnostics::compute_stats({&vel(0), &scal(0)});
+    ASSERT_EQ(stats.size(), 2);
+
+    const auto& vst = stats[0];
+    EXPECT_NEAR(vst.min[0], -2.0, 1.0e-12);
+    EXPECT_NEAR(vst.max[0], -2.0, 1.0e-12);
+    EXPECT_NEAR(vst.min[1], -5.0, 1.0e-12);
+    EXPECT_NEAR(vst.max[1], 1.0, 1.0e-12);
+    EXPECT_NEAR(vst.norm0(1), 5.0, 1.0e-12);
+    EXPECT_NEAR(vst.norm0(2), 3.0, 1.0e-12);
+    EXPECT_FALSE(vst.any_nan());
+
+    const auto& sst = stats[1];
+    EXPECT_TRUE(sst.any_nan());
+    EXPECT_NEAR(sst.min[0], 0.5, 1.0e-12);
+    EXPECT_NEAR(sst.max[0], 0.5, 1.0e-12);
+}
+
+TEST_F(DiagnosticsTest, compute_stats_many_components)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& tens = frepo.declare_field("tens", 5, 0);
+    tens.setVal(amrex::Vector<amrex::Real>{1.0, 2.0, 3.0, 4.0, 5.0});
+
+    // Components are reduced in groups, check the ones after the first group
+    const amrex::Real qnan = std::numeric_limits<amrex::Real>::quiet_NaN();
+    for (amrex::MFIter mfi(tens(0)); mfi.isValid(); ++mfi) {
+        const auto& tarr = tens(0).array(mfi);
+        const auto lo = amrex::lbound(mfi.validbox());
+        amrex::ParallelFor(1, [=] AMREX_GPU_DEVICE(int) noexcept {
+            tarr(lo.x, lo.y, lo.z, 3) = -7.0;
+            tarr(lo.x, lo.y, lo.z, 4) = qnan;
+        });
+    }
+
+    const auto stats = amr_wind::diagnostics::compute_stats({&tens(0)});
+    ASSERT_EQ(stats.size(), 1);
+
+    const auto& st = stats[0];
+    for (int n = 0; n < 3; ++n) {
+        EXPECT_NEAR(st.min[n], n + 1.0, 1.0e-12);
+        EXPECT_NEAR(st.max[n], n + 1.0, 1.0e-12);
+        EXPECT_EQ(st.has_nan[n], 0);
+    }
+    EXPECT_NEAR(st.min[3], -7.0, 1.0e-12);
+    EXPECT_NEAR(st.max[3], 4.0, 1.0e-12);
+    EXPECT_EQ(st.has_nan[3], 0);
+    EXPECT_NEAR(st.min[4], 5.0, 1.0e-12);
+    EXPECT_NE(st.has_nan[4], 0);
+}
+
+TEST_F(DiagnosticsTest, compute_stats_ghost_cells)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& vel = frepo.declare_field("vel", 3, 1);
+    vel.setVal(1.0);
+
+    // A NaN in a ghost cell is only reported when ghost cells are included
+    const amrex::Real qnan = std::numeric_limits<amrex::Real>::quiet_NaN();
+    for (amrex::MFIter mfi(vel(0)); mfi.isValid(); ++mfi) {
+        const auto& varr = vel(0).array(mfi);
+        const auto lo = amrex::lbound(mfi.fabbox());
+        amrex::ParallelFor(1, [=] AMREX_GPU_DEVICE(int) noexcept {
+            varr(lo.x, lo.y, lo.z, 2) = qnan;
+        });
+    }
+
+    const auto valid = amr_wind::diagnostics::compute_stats({&vel(0)});
+    EXPECT_FALSE(valid[0].any_nan());
+
+    const auto all = amr_wind::diagnostics::compute_stats({&vel(0)}, true);
+    EXPECT_EQ(all[0].has_nan[0], 0);
+    EXPECT_EQ(all[0].has_nan[1], 0);
+    EXPECT_NE(all[0].has_nan[2], 0);
+}
+
+} // namespace amr_wind_tests
@@ -16,7 +16,7 @@ namespace amr_wind_tests {
 class FieldPlaneAveragingTest : public MeshTest
 {
 public:
-    void test_dir(int /*dir*/);
+    void test_dir(int /*dir*/, bool deterministic = false);
 };
 
 TEST_F(FieldPlaneAveragingTest, test_constant)
@@ -203,7 +203,7 @@ void add_periodic(
 
 } // namespace
 
-void FieldPlaneAveragingTest::test_dir(int dir)
+void FieldPlaneAveragingTest::test_dir(int dir, bool deterministic)
 {
 
     constexpr double tol = 1.0e-12;
@@ -240,8 +240,26 @@ void FieldPlaneAveragingTest::test_dir(int dir)
         });
 
     amr_wind::FieldPlaneAveraging pa(velocityf, sim().time(), dir);
+    pa.deterministic() = deterministic;
     pa();
 
+    if (deterministic) {
+        // Repeated evaluation must give bitwise identical results and agree
+        // with the atomic reduction
+        const auto line_avg = pa.line_average();
+        pa();
+        for (size_t i = 0; i < line_avg.size(); ++i) {
+            EXPECT_EQ(line_avg[i], pa.line_average()[i]);
+        }
+
+        amr_wind::FieldPlaneAveraging pa_ref(velocityf, sim().time(), dir);
+        pa_ref.deterministic() = false;
+        pa_ref();
+        for (size_t i = 0; i < line_avg.size(); ++i) {
+            EXPECT_NEAR(line_avg[i], pa_ref.line_average()[i], tol);
+        }
+    }
+
     amrex::Real x = 0.5 * (problo[dir] + probhi[dir]);
     amrex::Real u = pa.line_average_interpolated(x, 0);
     amrex::Real v = pa.line_average_interpolated(x, 1);
@@ -257,5 +275,8 @@ void FieldPlaneAveragingTest::test_dir(int dir)
 TEST_F(FieldPlaneAveragingTest, test_xdir) { test_dir(0); }
 TEST_F(FieldPlaneAveragingTest, test_ydir) { test_dir(1); }
 TEST_F(FieldPlaneAveragingTest, test_zdir) { test_dir(2); }
+TEST_F(FieldPlaneAveragingTest, test_xdir_deterministic) { test_dir(0, true); }
+TEST_F(FieldPlaneAveragingTest, test_ydir_deterministic) { test_dir(1, true); }
+TEST_F(FieldPlaneAveragingTest, test_zdir_deterministic) { test_dir(2, true); }
 
 } // namespace amr_wind_tests
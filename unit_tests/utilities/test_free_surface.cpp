@@ -493,6 +493,36 @@ TEST_F(FreeSurfaceTest, plane)
     ASSERT_EQ(nout, npts * npts);
 }
 
+TEST_F(FreeSurfaceTest, plane_multibox)
+{
+    // Columns and the 2D grid span several boxes
+    populate_parameters();
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 8);
+    }
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vof = repo.declare_field("vof", 1, 2);
+    {
+        amrex::ParmParse pp("freesurface");
+        pp.add("output_frequency", 1);
+        pp.add("num_instances", 1);
+        pp.addarr("num_points", amrex::Vector<int>{17, 9});
+        pp.addarr("start", pl_start);
+        pp.addarr("end", pl_end);
+    }
+
+    amrex::Real liwl = init_vof(vof, water_level1);
+    auto& m_sim = sim();
+    FreeSurfaceImpl tool(m_sim, "freesurface");
+    tool.initialize();
+    tool.post_advance_work();
+
+    int nout = tool.check_output("~", liwl);
+    ASSERT_EQ(nout, 17 * 9);
+}
+
 TEST_F(FreeSurfaceTest, multivalued)
 {
     initialize_mesh();
@@ -59,6 +59,39 @@ protected:
     }
 };
 
+class MovingSampler : public amr_wind::sampling::SamplerBase
+{
+public:
+    std::string label() const override { return m_label; }
+    std::string& label() override { return m_label; }
+    int id() const override { return m_id; }
+    int& id() override { return m_id; }
+    int num_points() const override { return m_npts; }
+    void initialize(const std::string& /*key*/) override {}
+
+    void sampling_locations(SampleLocType& locs) const override
+    {
+        locs.resize(m_npts);
+        for (int i = 0; i < m_npts; ++i) {
+            locs[i][0] = m_xloc;
+            locs[i][1] = 66.0;
+            locs[i][2] = 1.0 + 126.0 * i / (m_npts - 1);
+        }
+    }
+
+    void update_sampling_locations() override { m_xloc += 32.0; }
+
+    bool locations_changed() const override { return true; }
+
+    amrex::Real xloc() const { return m_xloc; }
+
+private:
+    std::string m_label{"moving"};
+    int m_id{0};
+    int m_npts{16};
+    amrex::Real m_xloc{10.0};
+};
+
 } // namespace
 
 class SamplingTest : public MeshTest
@@ -250,4 +283,111 @@ TEST_F(SamplingTest, plane_sampler)
 #endif
 }
 
+TEST_F(SamplingTest, update_positions)
+{
+    using ParIter = amr_wind::sampling::SamplingContainer::ParIterType;
+    using IIx = amr_wind::sampling::IIx;
+    initialize_mesh();
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    samplers.emplace_back(std::make_unique<MovingSampler>());
+    const auto& probe = static_cast<const MovingSampler&>(*samplers[0]);
+    const int npts = probe.num_points();
+
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(1);
+    sc.initialize_particles(samplers);
+    sc.Redistribute();
+    sc.num_sampling_particles() = npts;
+
+    // Moving the probe must relocate the existing particles
+    samplers[0]->update_sampling_locations();
+    sc.update_positions(samplers);
+
+    const amrex::Real xloc = probe.xloc();
+    const int lev = 0;
+    int total_particles = 0;
+    int num_errors = 0;
+    for (ParIter pti(sc, lev); pti.isValid(); ++pti) {
+        const int np = pti.numParticles();
+        total_particles += np;
+        const auto& bx = pti.tilebox();
+        const auto& problo = mesh().Geom(lev).ProbLoArray();
+        const auto& dxi = mesh().Geom(lev).InvCellSizeArray();
+        const auto& pvec = pti.GetArrayOfStructs()();
+        amrex::Vector<amr_wind::sampling::SamplingContainer::ParticleType>
+            hpvec(np);
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, pvec.begin(), pvec.end(), hpvec.begin());
+        for (const auto& p : hpvec) {
+            const amrex::IntVect iv(AMREX_D_DECL(
+                static_cast<int>((p.pos(0) - problo[0]) * dxi[0]),
+                static_cast<int>((p.pos(1) - problo[1]) * dxi[1]),
+                static_cast<int>((p.pos(2) - problo[2]) * dxi[2])));
+            if ((std::abs(p.pos(0) - xloc) > 1.0e-12) || !bx.contains(iv) ||
+                (p.idata(IIx::nid) != p.idata(IIx::uid))) {
+                ++num_errors;
+            }
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(total_particles);
+    amrex::ParallelDescriptor::ReduceIntSum(num_errors);
+    EXPECT_EQ(total_particles, npts);
+    EXPECT_EQ(num_errors, 0);
+}
+
+TEST_F(SamplingTest, interpolate_fields)
+{
+    using ParIter = amr_wind::sampling::SamplingContainer::ParIterType;
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    auto& pres = repo.declare_nd_field("pressure", 1, 2);
+    auto& rho = repo.declare_field("density", 1, 2);
+    init_field(vel);
+    init_field(pres);
+    init_field(rho);
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    samplers.emplace_back(std::make_unique<MovingSampler>());
+    const int npts = samplers[0]->num_points();
+
+    // Mixed cell and node fields share a single interpolation pass
+    const amrex::Vector<amr_wind::Field*> fields{&rho, &pres, &vel};
+    const int ncomp = 5;
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(ncomp);
+    sc.initialize_particles(samplers);
+    sc.Redistribute();
+    sc.num_sampling_particles() = npts;
+    sc.interpolate_fields(fields);
+
+    const int lev = 0;
+    int num_errors = 0;
+    for (ParIter pti(sc, lev); pti.isValid(); ++pti) {
+        const int np = pti.numParticles();
+        const auto& pvec = pti.GetArrayOfStructs()();
+        amrex::Vector<amr_wind::sampling::SamplingContainer::ParticleType>
+            hpvec(np);
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, pvec.begin(), pvec.end(), hpvec.begin());
+        for (int ic = 0; ic < ncomp; ++ic) {
+            const auto& parr = pti.GetStructOfArrays().GetRealData(ic);
+            amrex::Vector<amrex::Real> hparr(np);
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, parr.begin(), parr.end(),
+                hparr.begin());
+            for (int ip = 0; ip < np; ++ip) {
+                const auto& p = hpvec[ip];
+                const amrex::Real expected = p.pos(0) + p.pos(1) + p.pos(2);
+                if (std::abs(hparr[ip] - expected) > 1.0e-10) {
+                    ++num_errors;
+                }
+            }
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(num_errors);
+    EXPECT_EQ(num_errors, 0);
+}
+
 } // namespace amr_wind_tests
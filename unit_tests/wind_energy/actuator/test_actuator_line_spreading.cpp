@@ -0,0 +1,174 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/wind_energy/actuator/ActSrcLineOp.H"
+#include "amr-wind/wind_energy/actuator/actuator_types.H"
+#include "amr-wind/wind_energy/actuator/actuator_utils.H"
+#include "amr-wind/core/vs/vector_space.H"
+
+namespace amr_wind_tests {
+namespace {
+
+namespace act = amr_wind::actuator;
+namespace vs = amr_wind::vs;
+
+class ActLineSpreadingTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{64, 64, 64}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", 32);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{128.0, 128.0, 128.0}};
+
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+};
+
+struct SpreadMeta
+{};
+
+struct LineSpreadTest : public act::ActuatorType
+{
+    using InfoType = act::ActInfo;
+    using GridType = act::ActGrid;
+    using MetaType = SpreadMeta;
+    using DataType = act::ActDataHolder<LineSpreadTest>;
+
+    static std::string identifier() { return "LineSpreadTest"; }
+};
+
+//! Reference brute-force spreading that evaluates every point for every cell
+void brute_force_spreading(
+    const act::ActGrid& grid, amr_wind::Field& src, const amrex::Geometry& geom)
+{
+    const int npts = grid.pos.size();
+    act::DeviceVecList d_pos(npts), d_force(npts), d_eps(npts);
+    act::DeviceTensorList d_tmat(npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, grid.pos.begin(), grid.pos.end(),
+        d_pos.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, grid.force.begin(), grid.force.end(),
+        d_force.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, grid.epsilon.begin(), grid.epsilon.end(),
+        d_eps.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, grid.orientation.begin(),
+        grid.orientation.end(), d_tmat.begin());
+
+    const auto& problo = geom.ProbLoArray();
+    const auto& dx = geom.CellSizeArray();
+    const auto* pos = d_pos.data();
+    const auto* force = d_force.data();
+    const auto* eps = d_eps.data();
+    const auto* tmat = d_tmat.data();
+
+    for (amrex::MFIter mfi(src(0)); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& sarr = src(0).array(mfi);
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                const vs::Vector cc{
+                    problo[0] + (i + 0.5) * dx[0],
+                    problo[1] + (j + 0.5) * dx[1],
+                    problo[2] + (k + 0.5) * dx[2],
+                };
+
+                amrex::Real src_force[AMREX_SPACEDIM]{0.0, 0.0, 0.0};
+                for (int ip = 0; ip < npts; ++ip) {
+                    const auto dist = cc - pos[ip];
+                    const auto dist_local = tmat[ip] & dist;
+                    const auto gauss_fac =
+                        act::utils::gaussian3d(dist_local, eps[ip]);
+                    const auto& pforce = force[ip];
+
+                    src_force[0] += gauss_fac * pforce.x();
+                    src_force[1] += gauss_fac * pforce.y();
+                    src_force[2] += gauss_fac * pforce.z();
+                }
+
+                sarr(i, j, k, 0) += src_force[0];
+                sarr(i, j, k, 1) += src_force[1];
+                sarr(i, j, k, 2) += src_force[2];
+            });
+    }
+}
+
+} // namespace
+
+TEST_F(ActLineSpreadingTest, culled_spreading_matches_brute_force)
+{
+    initialize_mesh();
+    auto& src = sim().repo().declare_field("actuator_src_term", 3, 0);
+    auto& ref = sim().repo().declare_field("reference_src_term", 3, 0);
+    src.setVal(0.0);
+    ref.setVal(0.0);
+
+    // Three-bladed rotor in the y-z plane with 50 points per blade
+    const int nblades = 3;
+    const int npts_blade = 50;
+    const amrex::Real radius = 40.0;
+    const vs::Vector hub{64.0, 64.0, 64.0};
+
+    LineSpreadTest::DataType data(sim(), "T0", 0);
+    auto& grid = data.grid();
+    grid.resize(nblades * npts_blade);
+    for (int ib = 0; ib < nblades; ++ib) {
+        const amrex::Real angle = 120.0 * ib + 10.0;
+        const auto tmat = vs::quaternion(vs::Vector::ihat(), angle);
+        const auto blade_dir = vs::Vector::khat() & tmat;
+        for (int ip = 0; ip < npts_blade; ++ip) {
+            const int idx = ib * npts_blade + ip;
+            const amrex::Real rloc = radius * (ip + 0.5) / npts_blade;
+            grid.pos[idx] = hub + rloc * blade_dir;
+            grid.force[idx] = vs::Vector{-1.0, 0.1 * ip, 0.01 * ib};
+            grid.epsilon[idx] = vs::Vector{3.0, 2.0, 2.0};
+            grid.orientation[idx] = tmat;
+        }
+    }
+
+    act::ops::ActSrcOp<LineSpreadTest, act::ActSrcLine> src_op(data);
+    src_op.initialize();
+    src_op.setup_op();
+
+    const auto& geom = mesh().Geom(0);
+
+    amrex::Gpu::synchronize();
+    const amrex::Real t0 = amrex::ParallelDescriptor::second();
+    for (amrex::MFIter mfi(src(0), amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        src_op(0, mfi, geom);
+    }
+    amrex::Gpu::synchronize();
+    const amrex::Real t1 = amrex::ParallelDescriptor::second();
+    brute_force_spreading(grid, ref, geom);
+    amrex::Gpu::synchronize();
+    const amrex::Real t2 = amrex::ParallelDescriptor::second();
+
+    amrex::Print() << "ActSrcLine spreading: culled = " << (t1 - t0)
+                   << " s, brute force = " << (t2 - t1) << " s" << std::endl;
+
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        const amrex::Real ref_max = ref(0).norm0(i);
+        EXPECT_GT(ref_max, 0.0);
+
+        amrex::MultiFab::Subtract(ref(0), src(0), i, i, 1, 0);
+        const amrex::Real diff = ref(0).norm0(i);
+        EXPECT_NEAR(diff, 0.0, 1.0e-12 * ref_max);
+    }
+}
+
+} // namespace amr_wind_tests
@@ -2,6 +2,8 @@
 #include "test_act_utils.H"
 
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
+#include "amr-wind/wind_energy/actuator/actuator_types.H"
+#include "amr-wind/wind_energy/actuator/actuator_utils.H"
 #include "amr-wind/core/gpu_utils.H"
 #include "amr-wind/core/vs/vector_space.H"
 
@@ -21,6 +23,8 @@ public:
 
     // Accessor for the particle data holder object
     amr_wind::actuator::ActuatorCloud& get_data_obj() { return point_data(); }
+
+    using amr_wind::actuator::ActuatorContainer::set_sparse_exchange;
 };
 
 class ActuatorTest : public MeshTest
@@ -46,6 +50,9 @@ protected:
             pp.addarr("prob_hi", probhi);
         }
     }
+
+    //! Compare the sparse velocity exchange against the global reduction
+    void check_sparse_exchange(const amrex::RealBox& bound_box);
 };
 
 } // namespace
@@ -168,4 +175,112 @@ TEST_F(ActuatorTest, act_container)
     }
 }
 
+void ActuatorTest::check_sparse_exchange(const amrex::RealBox& bound_box)
+{
+    namespace act = amr_wind::actuator;
+    namespace vs = amr_wind::vs;
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 3);
+    init_field(vel);
+
+    // As with TurbineFast, only the root process creates the actuator points
+    // and needs the velocities.
+    act::ActInfo info("T0", 0);
+    info.bound_box = bound_box;
+    info.procs = act::utils::determine_influenced_procs(mesh(), info.bound_box);
+    info.root_proc = *info.procs.begin();
+    info.is_root_proc = (info.root_proc == iproc);
+    info.actuator_in_proc = (info.procs.count(iproc) > 0);
+    info.sample_vel_in_proc = info.is_root_proc;
+
+    amrex::Vector<const act::ActInfo*> infos{&info};
+    const auto peers = act::utils::determine_peer_procs(infos);
+
+    // The point-to-point exchange requires a symmetric peer relation
+    {
+        amrex::Vector<int> adjacency(nprocs * nprocs, 0);
+        for (const int ip : peers) {
+            adjacency[iproc * nprocs + ip] = 1;
+        }
+        amrex::ParallelDescriptor::ReduceIntSum(
+            adjacency.data(), adjacency.size());
+        for (int i = 0; i < nprocs; ++i) {
+            for (int j = 0; j < nprocs; ++j) {
+                EXPECT_EQ(adjacency[i * nprocs + j], adjacency[j * nprocs + i]);
+            }
+        }
+    }
+
+    const int num_nodes = 64;
+    TestActContainer ac(mesh(), info.sample_vel_in_proc ? 1 : 0);
+    auto& data = ac.get_data_obj();
+    if (info.sample_vel_in_proc) {
+        data.num_pts[0] = num_nodes;
+    }
+    ac.initialize_container();
+
+    auto& pvec = data.position;
+    const auto* blo = bound_box.lo();
+    const auto* bhi = bound_box.hi();
+    const amrex::Real dz = (bhi[2] - blo[2]) / num_nodes;
+    for (int ni = 0; ni < ac.num_actuator_points(); ++ni) {
+        // Alternate between points close to the two x-faces of the box
+        const amrex::Real xpos = (ni % 2 == 0) ? blo[0] + 4.0 : bhi[0] - 4.0;
+        pvec[ni] = vs::Vector{
+            xpos, 0.5 * (blo[1] + bhi[1]), blo[2] + (ni + 0.5) * dz};
+    }
+
+    // Sample with the global reduction first and then with the sparse exchange
+    amrex::Vector<vs::Vector> vel_allreduce;
+    for (const bool sparse : {false, true}) {
+        if (sparse) {
+            ac.reset_container();
+        }
+        ac.set_sparse_exchange(sparse, peers);
+
+        amrex::Real elapsed = amrex::ParallelDescriptor::second();
+        ac.update_positions();
+        ac.sample_velocities(vel);
+        elapsed = amrex::ParallelDescriptor::second() - elapsed;
+        amrex::ParallelDescriptor::ReduceRealMax(elapsed);
+        amrex::Print() << "Actuator velocity sampling ("
+                       << (sparse ? "sparse" : "allreduce") << ", " << nprocs
+                       << " ranks): " << elapsed << " s" << std::endl;
+
+        if (!sparse) {
+            vel_allreduce = data.velocity;
+        }
+    }
+
+    const auto& vvec = data.velocity;
+    for (int ip = 0; ip < ac.num_actuator_points(); ++ip) {
+        const amrex::Real vval = pvec[ip].x() + pvec[ip].y() + pvec[ip].z();
+        const vs::Vector vgold{vval, vval, vval};
+        EXPECT_NEAR(vs::mag_sqr(vvec[ip] - vgold), 0.0, 1.0e-12);
+        EXPECT_NEAR(vs::mag_sqr(vvec[ip] - vel_allreduce[ip]), 0.0, 1.0e-24);
+    }
+
+    // All ranks, with or without peers, must agree on the next message tag
+    int seq_min = amrex::ParallelDescriptor::SeqNum();
+    int seq_max = seq_min;
+    amrex::ParallelDescriptor::ReduceIntMin(seq_min);
+    amrex::ParallelDescriptor::ReduceIntMax(seq_max);
+    EXPECT_EQ(seq_min, seq_max);
+}
+
+TEST_F(ActuatorTest, act_container_sparse_exchange)
+{
+    // Turbine spanning the boxes of several ranks
+    check_sparse_exchange(amrex::RealBox(56.0, 56.0, 0.0, 72.0, 72.0, 128.0));
+}
+
+TEST_F(ActuatorTest, act_container_sparse_exchange_idle_ranks)
+{
+    // Turbine covering two boxes, the remaining ranks have no peers
+    check_sparse_exchange(amrex::RealBox(56.0, 0.0, 0.0, 72.0, 16.0, 16.0));
+}
+
 } // namespace amr_wind_tests